@@ -0,0 +1,122 @@
+﻿#include "Benchmark.h"
+#include "Containers/VulIndexedPriorityQueue.h"
+#include "Containers/VulPriorityQueue.h"
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	BenchmarkPriorityQueue,
+	"VulRuntime.Containers.BenchmarkPriorityQueue",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter
+)
+
+namespace
+{
+	/**
+	 * A Dijkstra-like workload over an implicit grid: each element is popped once, but
+	 * may have its priority lowered a few times before that happens.
+	 */
+	constexpr int32 Elements = 10000;
+	constexpr int32 UpdatesPerElement = 4;
+
+	int32 InitialPriority(const int32 Element)
+	{
+		return 1000 + (Element * 7919) % 1000;
+	}
+
+	int32 LoweredPriority(const int32 Element, const int32 Update)
+	{
+		return InitialPriority(Element) - (Update + 1) * ((Element * 31) % 200 + 1);
+	}
+}
+
+bool BenchmarkPriorityQueue::RunTest(const FString& Parameters)
+{
+	int64 Checksum = 0;
+
+	const auto Duplicates = VulTest::Benchmark(this, TEXT("TVulPriorityQueue (duplicate entries)"), 20, [&]
+	{
+		TVulPriorityQueue<int32, int32> Queue;
+		TArray<int32> Best;
+		Best.SetNumUninitialized(Elements);
+
+		for (int32 I = 0; I < Elements; ++I)
+		{
+			Best[I] = InitialPriority(I);
+			Queue.Add(I, Best[I]);
+		}
+
+		for (int32 U = 0; U < UpdatesPerElement; ++U)
+		{
+			for (int32 I = 0; I < Elements; ++I)
+			{
+				Best[I] = LoweredPriority(I, U);
+				Queue.Add(I, Best[I]);
+			}
+		}
+
+		while (auto Entry = Queue.Get())
+		{
+			// Stale entries must be skipped.
+			if (Entry->Priority == Best[Entry->Element])
+			{
+				Checksum += Entry->Element;
+			}
+		}
+	});
+
+	const auto Indexed = VulTest::Benchmark(this, TEXT("TVulIndexedPriorityQueue (decrease-key)"), 20, [&]
+	{
+		TVulIndexedPriorityQueue<int32, int32> Queue;
+		Queue.Reserve(Elements);
+
+		for (int32 I = 0; I < Elements; ++I)
+		{
+			Queue.Add(I, InitialPriority(I));
+		}
+
+		for (int32 U = 0; U < UpdatesPerElement; ++U)
+		{
+			for (int32 I = 0; I < Elements; ++I)
+			{
+				Queue.Update(I, LoweredPriority(I, U));
+			}
+		}
+
+		while (!Queue.IsEmpty())
+		{
+			Checksum += Queue.GetElement(Queue.Pop());
+		}
+	});
+
+	const auto Bucket = VulTest::Benchmark(this, TEXT("TVulBucketPriorityQueue (decrease-key)"), 20, [&]
+	{
+		TVulBucketPriorityQueue<int32> Queue;
+		Queue.Reserve(Elements, 2000);
+
+		for (int32 I = 0; I < Elements; ++I)
+		{
+			Queue.Add(I, InitialPriority(I));
+		}
+
+		for (int32 U = 0; U < UpdatesPerElement; ++U)
+		{
+			for (int32 I = 0; I < Elements; ++I)
+			{
+				Queue.Update(I, LoweredPriority(I, U));
+			}
+		}
+
+		while (!Queue.IsEmpty())
+		{
+			Checksum += Queue.GetElement(Queue.Pop());
+		}
+	});
+
+	VulTest::LogSpeedup(this, Duplicates, Indexed);
+	VulTest::LogSpeedup(this, Duplicates, Bucket);
+
+	// Each run pops every element exactly once.
+	TestEqual(TEXT("All elements popped"), Checksum, static_cast<int64>(Elements - 1) * Elements / 2 * 21 * 3);
+
+	return true;
+}
@@ -0,0 +1,131 @@
+﻿#include "Containers/VulIndexedPriorityQueue.h"
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	IndexedPriorityQueueTest,
+	"VulRuntime.Containers.TestIndexedPriorityQueue",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter
+)
+
+/**
+ * Tests shared by both queue implementations, which offer the same interface.
+ */
+template <typename QueueType>
+void TestCommonQueueBehaviour(FAutomationTestBase* Test, const FString& Name)
+{
+	const auto Msg = [&Name](const TCHAR* What) { return FString::Printf(TEXT("%s: %s"), *Name, What); };
+
+	QueueType Queue;
+
+	const auto One = Queue.Add(TEXT("One"), 5);
+	const auto Two = Queue.Add(TEXT("Two"), 3);
+	const auto Three = Queue.Add(TEXT("Three"), 2);
+	const auto Four = Queue.Add(TEXT("Four"), 7);
+
+	Test->TestEqual(Msg(TEXT("Num")), Queue.Num(), 4);
+	Test->TestEqual(Msg(TEXT("Top")), Queue.GetElement(Queue.Top()), FString(TEXT("Three")));
+	Test->TestEqual(Msg(TEXT("Top priority")), Queue.GetPriority(Queue.Top()), 2);
+
+	Queue.Update(Four, 1);
+	Queue.Update(Three, 6);
+
+	Test->TestEqual(Msg(TEXT("Decreased priority")), Queue.GetPriority(Four), 1);
+	Test->TestEqual(Msg(TEXT("Update does not add")), Queue.Num(), 4);
+
+	Test->TestEqual(Msg(TEXT("1st element")), Queue.GetElement(Queue.Pop()), FString(TEXT("Four")));
+	Test->TestEqual(Msg(TEXT("Popped is not queued")), Queue.IsQueued(Four), false);
+	Test->TestEqual(Msg(TEXT("Others still queued")), Queue.IsQueued(One), true);
+	Test->TestEqual(Msg(TEXT("2nd element")), Queue.GetElement(Queue.Pop()), FString(TEXT("Two")));
+	Test->TestEqual(Msg(TEXT("3rd element")), Queue.GetElement(Queue.Pop()), FString(TEXT("One")));
+	Test->TestEqual(Msg(TEXT("4th element")), Queue.GetElement(Queue.Pop()), FString(TEXT("Three")));
+	Test->TestEqual(Msg(TEXT("Empty")), Queue.IsEmpty(), true);
+
+	Test->TestEqual(Msg(TEXT("Popped element still accessible")), Queue.GetElement(Two), FString(TEXT("Two")));
+
+	// Re-adding after popping is how searches re-open a node.
+	const auto Reopened = Queue.Add(TEXT("Two"), 1);
+	Test->TestEqual(Msg(TEXT("Re-added")), Queue.IsQueued(Reopened), true);
+	Test->TestEqual(Msg(TEXT("Re-added gets a new handle")), Reopened != Two, true);
+
+	Queue.Reset();
+	Test->TestEqual(Msg(TEXT("Reset empty")), Queue.IsEmpty(), true);
+	Test->TestEqual(Msg(TEXT("Reset handles not queued")), Queue.IsQueued(Reopened), false);
+
+	// Reuse after reset.
+	for (int I = 0; I < 100; ++I)
+	{
+		Queue.Add(FString::FromInt(I), (I * 37) % 100);
+	}
+
+	int Previous = -1;
+	bool Ordered = true;
+
+	while (!Queue.IsEmpty())
+	{
+		const auto Handle = Queue.Top();
+		const auto Priority = Queue.GetPriority(Handle);
+		Ordered &= Priority >= Previous;
+		Previous = Priority;
+		Queue.Pop();
+	}
+
+	Test->TestEqual(Msg(TEXT("Reused queue ordered")), Ordered, true);
+}
+
+bool IndexedPriorityQueueTest::RunTest(const FString& Parameters)
+{
+	TestCommonQueueBehaviour<TVulIndexedPriorityQueue<FString, int32>>(this, TEXT("Indexed"));
+	TestCommonQueueBehaviour<TVulBucketPriorityQueue<FString>>(this, TEXT("Bucket"));
+
+	auto CustomQueue = TVulIndexedPriorityQueue<FString, float, TGreater<float>>();
+
+	CustomQueue.Add(TEXT("One"), 5);
+	CustomQueue.Add(TEXT("Two"), 3);
+	const auto Three = CustomQueue.Add(TEXT("Three"), 2);
+
+	TestEqual(TEXT("Custom: 1st element"), CustomQueue.GetElement(CustomQueue.Pop()), FString(TEXT("One")));
+
+	CustomQueue.Update(Three, 4);
+
+	TestEqual(TEXT("Custom: 2nd element"), CustomQueue.GetElement(CustomQueue.Pop()), FString(TEXT("Three")));
+	TestEqual(TEXT("Custom: 3rd element"), CustomQueue.GetElement(CustomQueue.Pop()), FString(TEXT("Two")));
+	TestEqual(TEXT("Custom: Empty"), CustomQueue.IsEmpty(), true);
+
+	auto BucketQueue = TVulBucketPriorityQueue<FString>();
+
+	BucketQueue.Add(TEXT("A"), 1);
+	const auto B = BucketQueue.Add(TEXT("B"), 1);
+	BucketQueue.Add(TEXT("C"), 1);
+	BucketQueue.Add(TEXT("D"), 0);
+
+	TestEqual(TEXT("Bucket: lowest first"), BucketQueue.GetElement(BucketQueue.Pop()), FString(TEXT("D")));
+
+	// Updating moves the element to the back of its new priority.
+	BucketQueue.Update(B, 1);
+
+	TestEqual(TEXT("Bucket: ties in order added (1)"), BucketQueue.GetElement(BucketQueue.Pop()), FString(TEXT("A")));
+	TestEqual(TEXT("Bucket: ties in order added (2)"), BucketQueue.GetElement(BucketQueue.Pop()), FString(TEXT("C")));
+	TestEqual(TEXT("Bucket: ties in order added (3)"), BucketQueue.GetElement(BucketQueue.Pop()), FString(TEXT("B")));
+
+	// Adding below the previously popped priority.
+	BucketQueue.Add(TEXT("E"), 5);
+	BucketQueue.Add(TEXT("F"), 0);
+
+	TestEqual(TEXT("Bucket: lower priority after pop"), BucketQueue.GetElement(BucketQueue.Pop()), FString(TEXT("F")));
+	TestEqual(TEXT("Bucket: last"), BucketQueue.GetElement(BucketQueue.Pop()), FString(TEXT("E")));
+
+	auto NewestFirstQueue = TVulBucketPriorityQueue<FString, int32, true>();
+
+	NewestFirstQueue.Add(TEXT("A"), 1);
+	const auto NewestB = NewestFirstQueue.Add(TEXT("B"), 1);
+	NewestFirstQueue.Add(TEXT("C"), 1);
+
+	// Updating moves the element to the front of its new priority.
+	NewestFirstQueue.Update(NewestB, 1);
+
+	TestEqual(TEXT("Newest first: ties in reverse (1)"), NewestFirstQueue.GetElement(NewestFirstQueue.Pop()), FString(TEXT("B")));
+	TestEqual(TEXT("Newest first: ties in reverse (2)"), NewestFirstQueue.GetElement(NewestFirstQueue.Pop()), FString(TEXT("C")));
+	TestEqual(TEXT("Newest first: ties in reverse (3)"), NewestFirstQueue.GetElement(NewestFirstQueue.Pop()), FString(TEXT("A")));
+
+	return true;
+}
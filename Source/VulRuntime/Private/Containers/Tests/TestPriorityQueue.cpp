@@ -51,5 +51,8 @@ bool PriorityQueueTest::RunTest(const FString& Parameters)
 	TestEqual(TEXT("Custom: Empty"), CustomQueue.IsEmpty(), true);
 	TestEqual(TEXT("Custom: Empty unset"), CustomQueue.Get().IsSet(), false);
 
+	TestEqual(TEXT("Entry: less than"), TestQueue::FEntry{{}, 1} < TestQueue::FEntry{{}, 2}, true);
+	TestEqual(TEXT("Entry: not less than"), TestQueue::FEntry{{}, 2} < TestQueue::FEntry{{}, 1}, false);
+
 	return true;
 }
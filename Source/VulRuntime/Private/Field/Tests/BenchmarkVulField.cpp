@@ -0,0 +1,197 @@
+﻿#include "Benchmark.h"
+#include "TestVulFieldStructs.h"
+#include "Field/VulField.h"
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	BenchmarkVulField,
+	"VulRuntime.Field.BenchmarkVulField",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter
+)
+
+bool BenchmarkVulField::RunTest(const FString& Parameters)
+{
+	// The type identity work done for every registered value created, added to a field set or serialized.
+	int64 Checksum = 0;
+
+	const auto Hashed = VulTest::Benchmark(this, TEXT("Type lookup (per-call MD5)"), 20, [&]
+	{
+		for (int I = 0; I < 10000; ++I)
+		{
+			const auto Id = FMD5::HashAnsiString(*VulRuntime::Field::TypeInfo<FVulFieldTestTreeNode1>());
+			Checksum += FVulFieldRegistry::Get().Has(Id) ? Id.Len() : 0;
+		}
+	});
+
+	const auto Cached = VulTest::Benchmark(this, TEXT("Type lookup (cached key)"), 20, [&]
+	{
+		for (int I = 0; I < 10000; ++I)
+		{
+			const auto Entry = FVulFieldRegistry::Get().Find<FVulFieldTestTreeNode1>();
+			Checksum += Entry != nullptr ? Entry->TypeId.Len() : 0;
+		}
+	});
+
+	VulTest::LogSpeedup(this, Hashed, Cached);
+
+	// 10k registered structs, each building a field set per serialization.
+	TArray<TSharedPtr<FVulFieldTestTreeBase>> Trees;
+
+	for (int I = 0; I < 10000; ++I)
+	{
+		if (I % 2 == 0)
+		{
+			const auto Node = MakeShared<FVulFieldTestTreeNode1>();
+			Node->Int = I;
+			Trees.Add(Node);
+		} else
+		{
+			const auto Node = MakeShared<FVulFieldTestTreeNode2>();
+			Node->String = FString::FromInt(I);
+			Trees.Add(Node);
+		}
+	}
+
+	const auto Dom = VulTest::Benchmark(this, TEXT("Serialize 10k tree nodes (DOM)"), 5, [&]
+	{
+		FString Json;
+		FVulField::Create(&Trees).SerializeToJson(Json);
+		Checksum += Json.Len();
+	});
+
+	const auto Streamed = VulTest::Benchmark(this, TEXT("Serialize 10k tree nodes (streamed)"), 5, [&]
+	{
+		FString Json;
+		FVulField::Create(&Trees).StreamToJson(Json);
+		Checksum += Json.Len();
+	});
+
+	VulTest::LogSpeedup(this, Dom, Streamed);
+
+	// 10k field set structs, read back from JSON.
+	TArray<FVulFieldTestSingleInstance> Instances;
+	Instances.SetNum(10000);
+
+	for (int I = 0; I < Instances.Num(); ++I)
+	{
+		Instances[I].Int = I;
+		Instances[I].Str = FString::Printf(TEXT("instance %d"), I);
+	}
+
+	FString InstancesJson;
+	FVulField::Create(&Instances).StreamToJson(InstancesJson);
+
+	const auto DomRead = VulTest::Benchmark(this, TEXT("Deserialize 10k structs (DOM)"), 5, [&]
+	{
+		TArray<FVulFieldTestSingleInstance> Read;
+		FVulField::Create(&Read).DeserializeFromJson(InstancesJson);
+		Checksum += Read.Num();
+	});
+
+	const auto StreamedRead = VulTest::Benchmark(this, TEXT("Deserialize 10k structs (streamed)"), 5, [&]
+	{
+		TArray<FVulFieldTestSingleInstance> Read;
+		FVulField::Create(&Read).StreamFromJson(InstancesJson);
+		Checksum += Read.Num();
+	});
+
+	VulTest::LogSpeedup(this, DomRead, StreamedRead);
+
+	// The same structs in the binary format.
+	TArray<uint8> InstancesBinary;
+	FVulField::Create(&Instances).StreamToBinary(InstancesBinary);
+	AddInfo(FString::Printf(
+		TEXT("10k structs are %d bytes as JSON, %d bytes as binary"),
+		FTCHARToUTF8(*InstancesJson).Length(),
+		InstancesBinary.Num()
+	));
+
+	const auto JsonWrite = VulTest::Benchmark(this, TEXT("Serialize 10k structs (JSON)"), 5, [&]
+	{
+		FString Json;
+		FVulField::Create(&Instances).StreamToJson(Json);
+		Checksum += Json.Len();
+	});
+
+	const auto BinaryWrite = VulTest::Benchmark(this, TEXT("Serialize 10k structs (binary)"), 5, [&]
+	{
+		TArray<uint8> Binary;
+		FVulField::Create(&Instances).StreamToBinary(Binary);
+		Checksum += Binary.Num();
+	});
+
+	VulTest::LogSpeedup(this, JsonWrite, BinaryWrite);
+
+	const auto BinaryRead = VulTest::Benchmark(this, TEXT("Deserialize 10k structs (binary)"), 5, [&]
+	{
+		TArray<FVulFieldTestSingleInstance> Read;
+		FVulField::Create(&Read).StreamFromBinary(InstancesBinary);
+		Checksum += Read.Num();
+	});
+
+	VulTest::LogSpeedup(this, StreamedRead, BinaryRead);
+
+	// Path-scoped flag checks made at every node down a deep tree.
+	VulRuntime::Field::FPath DeepPath;
+
+	for (int I = 0; I < 40; ++I)
+	{
+		DeepPath.Add(I % 2 == 0
+			? VulRuntime::Field::FPathItem(TInPlaceType<FString>(), FString::Printf(TEXT("p%d"), I))
+			: VulRuntime::Field::FPathItem(TInPlaceType<int>(), I));
+	}
+
+	FVulFieldSerializationFlags PathFlags;
+	PathFlags.Set(VulFieldSerializationFlag_AnnotateTypes, true, ".p0[*].*[3].p4");
+	PathFlags.Set(VulFieldSerializationFlag_Referencing, false, ".*[1].p2");
+	PathFlags.Set(VulFieldSerializationFlag_AssetReferencing, false, ".p0[1].*");
+	PathFlags.Set(VulFieldSerializationFlag_AnnotateTypes, false, ".p0[1].p2[3].p4[5].p6.*");
+
+	VulRuntime::Field::FPath Path;
+	TFunction<void (int, bool)> Descend = [&](const int Depth, const bool bEnter)
+	{
+		if (Depth == DeepPath.Num())
+		{
+			return;
+		}
+
+		Path.Add(DeepPath[Depth]);
+
+		if (bEnter)
+		{
+			const auto Scope = PathFlags.Enter(DeepPath[Depth]);
+			Checksum += PathFlags.IsEnabled(VulFieldSerializationFlag_Referencing);
+			Checksum += PathFlags.IsEnabled(VulFieldSerializationFlag_AnnotateTypes);
+			Descend(Depth + 1, bEnter);
+		} else
+		{
+			Checksum += PathFlags.IsEnabled(VulFieldSerializationFlag_Referencing, Path);
+			Checksum += PathFlags.IsEnabled(VulFieldSerializationFlag_AnnotateTypes, Path);
+			Descend(Depth + 1, bEnter);
+		}
+
+		Path.Pop();
+	};
+
+	const auto FromRoot = VulTest::Benchmark(this, TEXT("Flag checks down a 40 deep path (matched from root)"), 20, [&]
+	{
+		for (int I = 0; I < 1000; ++I)
+		{
+			Descend(0, false);
+		}
+	});
+
+	const auto Entered = VulTest::Benchmark(this, TEXT("Flag checks down a 40 deep path (entered)"), 20, [&]
+	{
+		for (int I = 0; I < 1000; ++I)
+		{
+			Descend(0, true);
+		}
+	});
+
+	VulTest::LogSpeedup(this, FromRoot, Entered);
+
+	TestTrue(TEXT("Workloads ran"), Checksum != 0);
+
+	return true;
+}
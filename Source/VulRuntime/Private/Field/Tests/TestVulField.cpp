@@ -730,6 +730,279 @@ bool TestVulField::RunTest(const FString& Parameters)
 		VTC_MUST_EQUAL(Field.SerializeToJson(SerializedJson), true, "serialize");
 		VTC_MUST_EQUAL(*SerializedJson, TEXT("[\"E60D099796894926B0A14D18C339D78F\"]"), "serialize");
 	});
+
+	VulTest::Case(this, "Streaming serialization", [](VulTest::TC TC)
+	{
+		FVulTestFieldType TestObj = {
+			.B = true,
+			.I = 13,
+			.S = "quotes \" and \\ and\nnewlines",
+			.M = {{"foo", 13}, {"bar", 14}},
+			.A = {true, false, true},
+		};
+
+		FString Dom, Streamed;
+		VTC_MUST_EQUAL(FVulField::Create(&TestObj).SerializeToJson(Dom), true, "serialize")
+		VTC_MUST_EQUAL(FVulField::Create(&TestObj).StreamToJson(Streamed), true, "stream")
+		TC.Equal(*Streamed, *Dom, "object matches DOM output");
+
+		TSharedPtr<FVulFieldTestTreeBase> Root = MakeShared<FVulFieldTestTreeBase>();
+		TSharedPtr<FVulFieldTestTreeNode1> NodeA = MakeShared<FVulFieldTestTreeNode1>();
+		NodeA->Int = 13;
+		TSharedPtr<FVulFieldTestTreeNode2> NodeB = MakeShared<FVulFieldTestTreeNode2>();
+		NodeB->String = "";
+		Root->Children.Add(NodeB);
+		Root->Children.Add(NodeA);
+
+		Dom.Reset();
+		Streamed.Reset();
+		VTC_MUST_EQUAL(FVulField::Create(&Root).SerializeToJson(Dom), true, "serialize tree")
+		VTC_MUST_EQUAL(FVulField::Create(&Root).StreamToJson(Streamed), true, "stream tree")
+		TC.Equal(*Streamed, *Dom, "tree with omitted empties matches DOM output");
+
+		FVulFieldSerializationContext AnnotateDomCtx, AnnotateStreamCtx;
+		AnnotateDomCtx.Flags.Set(VulFieldSerializationFlag_AnnotateTypes);
+		AnnotateStreamCtx.Flags.Set(VulFieldSerializationFlag_AnnotateTypes);
+		Dom.Reset();
+		Streamed.Reset();
+		VTC_MUST_EQUAL(FVulField::Create(&Root).SerializeToJson(Dom, AnnotateDomCtx), true, "serialize annotated")
+		VTC_MUST_EQUAL(FVulField::Create(&Root).StreamToJson(Streamed, AnnotateStreamCtx), true, "stream annotated")
+		TC.Equal(*Streamed, *Dom, "annotated types match DOM output");
+
+		FVulFieldTestDelegating Delegating;
+		Delegating.Node.Int = 3;
+		FVulFieldSerializationContext DelegatingDomCtx, DelegatingStreamCtx;
+		DelegatingDomCtx.Flags.Set(VulFieldSerializationFlag_AnnotateTypes);
+		DelegatingStreamCtx.Flags.Set(VulFieldSerializationFlag_AnnotateTypes);
+		Dom.Reset();
+		Streamed.Reset();
+		VTC_MUST_EQUAL(FVulField::Create(&Delegating).SerializeToJson(Dom, DelegatingDomCtx), true, "serialize delegating")
+		VTC_MUST_EQUAL(FVulField::Create(&Delegating).StreamToJson(Streamed, DelegatingStreamCtx), true, "stream delegating")
+		TC.Equal(*Streamed, *Dom, "delegating type annotation matches DOM output");
+		TC.Equal(Streamed.Contains(TEXT("\"VulType\":\"VulFieldTestDelegating\"")), true, "annotated as the outer type");
+
+		FVulFieldTestSingleInstance Instance;
+		Instance.Int = 5;
+		Instance.Str = "foobar";
+		TArray Instances = {Instance, Instance};
+		TArray<float> Floats = {1.2, 2.1};
+		TOptional<FString> Empty;
+
+		FVulFieldSet Set;
+		Set.Add(FVulField::Create(Instances), "instances");
+		Set.Add(FVulField::Create(Floats), "floats");
+		Set.Add(FVulField::Create(Empty), "empty");
+		Set.Add<int>([] { return 7; }, "virtual");
+
+		Streamed.Reset();
+		VTC_MUST_EQUAL(Set.StreamToJson(Streamed), true, "stream field set")
+		TC.Equal(
+			*Streamed,
+			TEXT("{\"instances\":[{\"int\":5,\"str\":\"foobar\"},\"foobar\"],\"floats\":[1.2,2.1],\"virtual\":7}"),
+			"references, floats, omitted empties and virtual fields"
+		);
+
+		FVulFieldSerializationContext ExtractCtx;
+		ExtractCtx.ExtractReferences = true;
+		Streamed.Reset();
+		TC.Equal(Set.StreamToJson(Streamed, ExtractCtx), false, "extracted references are not supported");
+	});
+
+	VulTest::Case(this, "Streaming deserialization", [](VulTest::TC TC)
+	{
+		FVulTestFieldType TestObj;
+		const FString Json = "{\"bool\":false,\"unknown\":{\"a\":[1,{}]},\"int\":5,\"string\":\"quotes \\\" and\\n\",\"map\":{\"qux\":10},\"array\":[true, true, false]}";
+		
+		VTC_MUST_EQUAL(TestObj.FieldSet().StreamFromJson(Json), true, "stream from json")
+		TC.Equal(false, TestObj.B, "bool");
+		TC.Equal(5, TestObj.I, "int");
+		TC.Equal(FString("quotes \" and\n"), TestObj.S, "str");
+		TC.Equal(TMap<FString, int>{{"qux", 10}}, TestObj.M, "map");
+		TC.Equal(TArray{true, true, false}, TestObj.A, "array");
+
+		FVulTestFieldParent Parent;
+		VTC_MUST_EQUAL(Parent.VulFieldSet().StreamFromJson("{\"inner\":{\"array\":[true],\"int\":3}}"), true, "nested out of order")
+		TC.Equal(3, Parent.Inner.I, "nested int");
+		TC.Equal(TArray{true}, Parent.Inner.A, "nested array");
+
+		VTC_MUST_EQUAL(TestObj.FieldSet().StreamFromJson("{\"ARRAY\":[false],\"Int\":8}"), true, "keys ignore case")
+		TC.Equal(8, TestObj.I, "mixed case int");
+		TC.Equal(TArray{false}, TestObj.A, "upper case array");
+
+		// Polymorphic types without a streaming deserializer go via FJsonValue.
+		TSharedPtr<FVulFieldTestTreeBase> Root = MakeShared<FVulFieldTestTreeBase>();
+		const FString TreeJson = "{\"type\":\"Base\",\"children\":[{\"type\":\"Node2\",\"children\":[{\"type\":\"Node1\",\"int\":-5}],\"str\":\"foo\"},{\"type\":\"Node1\",\"int\":13}]}";
+		VTC_MUST_EQUAL(FVulField::Create(&Root).StreamFromJson(TreeJson), true, "stream tree")
+		
+		FString Reserialized;
+		VTC_MUST_EQUAL(FVulField::Create(&Root).StreamToJson(Reserialized), true, "reserialize tree")
+		TC.Equal(*Reserialized, *TreeJson, "tree round trip");
+
+		TArray<FVulFieldTestSingleInstance*> Arr;
+		TPair<FGuid, TOptional<float>> Pair;
+		FVulFieldSet Set;
+		Set.Add(FVulField::Create(&Arr), "data");
+		Set.Add(FVulField::Create(&Pair), "pair");
+		Set.Add<int>([] { return 7; }, "virtual");
+
+		const auto SetJson = TEXT("{\"data\":[{\"int\":5,\"str\":\"foobar\"},\"foobar\"],\"pair\":[\"2C4B7D11-4E0A-4B2B-8D1E-7A4A1F2E3D4C\",null],\"virtual\":8}");
+		VTC_MUST_EQUAL(Set.StreamFromJson(SetJson), true, "stream references, pairs & virtual fields")
+		
+		if (TC.Equal(Arr.Num(), 2, "pointer array length"))
+		{
+			TC.Equal(Arr[0], Arr[1], "pointers same");
+		}
+
+		TC.Equal(Pair.Key.IsValid(), true, "guid");
+		TC.Equal(Pair.Value.IsSet(), false, "null optional");
+
+		TArray<int> Ints;
+		TC.Equal(FVulField::Create(&Ints).StreamFromJson("[1,\"13\"]"), false, "wrong type fails");
+		TC.Equal(TestObj.FieldSet().StreamFromJson("{\"int\":1,"), false, "malformed input fails");
+		TC.Equal(FVulField::Create(static_cast<const TArray<int>&>(Ints)).StreamFromJson("[1]"), false, "read-only field fails");
+	});
+
+	VulTest::Case(this, "Binary format", [](VulTest::TC TC)
+	{
+		struct FAllTypes
+		{
+			bool B = false;
+			int32 I = 0;
+			int64 Big = 0;
+			uint8 Byte = 0;
+			float F = 0;
+			double D = 0;
+			FString S;
+			FString Upper;
+			FName N;
+			FText T;
+			TArray<int> A;
+			TMap<FString, int> M;
+			TOptional<FString> Opt;
+			TOptional<int> Null;
+			TSharedPtr<FVulFieldTestSingleInstance> Shared;
+			TUniquePtr<int> Unique;
+			EVulFieldTestTreeNodeType E = EVulFieldTestTreeNodeType::Base;
+			TPair<FString, int> Pair;
+			FGuid G;
+
+			FVulFieldSet VulFieldSet()
+			{
+				FVulFieldSet Set;
+				Set.Add(FVulField::Create(&B), "b");
+				Set.Add(FVulField::Create(&I), "i");
+				Set.Add(FVulField::Create(&Big), "big");
+				Set.Add(FVulField::Create(&Byte), "byte");
+				Set.Add(FVulField::Create(&F), "f");
+				Set.Add(FVulField::Create(&D), "d");
+				Set.Add(FVulField::Create(&S), "str");
+				Set.Add(FVulField::Create(&Upper), "upper");
+				Set.Add(FVulField::Create(&N), "n");
+				Set.Add(FVulField::Create(&T), "t");
+				Set.Add(FVulField::Create(&A), "a");
+				Set.Add(FVulField::Create(&M), "m");
+				Set.Add(FVulField::Create(&Opt), "opt");
+				Set.Add(FVulField::Create(&Null), "null").EvenIfEmpty();
+				Set.Add(FVulField::Create(&Shared), "shared");
+				Set.Add(FVulField::Create(&Unique), "unique");
+				Set.Add(FVulField::Create(&E), "e");
+				Set.Add(FVulField::Create(&Pair), "pair");
+				Set.Add(FVulField::Create(&G), "g");
+				return Set;
+			}
+		};
+
+		FAllTypes Written;
+		Written.B = true;
+		Written.I = -300;
+		Written.Big = 1ll << 40;
+		Written.Byte = 200;
+		Written.F = 1.5f;
+		Written.D = -2.125;
+		Written.S = TEXT("unicode \u2713 \"quoted\"");
+		// Same as a key but for case, which must not be interned as the key.
+		Written.Upper = "STR";
+		Written.N = "name";
+		Written.T = FText::FromString("text");
+		Written.A = {1, -2, 3};
+		Written.M = {{"str", 1}, {"long key which is not a short string value", 2}};
+		Written.Opt = FString("set");
+		Written.Shared = MakeShared<FVulFieldTestSingleInstance>();
+		Written.Shared->Int = 5;
+		Written.Shared->Str = "shared";
+		Written.Unique = MakeUnique<int>(7);
+		Written.E = EVulFieldTestTreeNodeType::Node2;
+		Written.Pair = {"pair", 4};
+		Written.G = FGuid::NewGuid();
+
+		TArray<uint8> Binary;
+		VTC_MUST_EQUAL(Written.VulFieldSet().StreamToBinary(Binary), true, "write binary")
+
+		FAllTypes Read;
+		VTC_MUST_EQUAL(Read.VulFieldSet().StreamFromBinary(Binary), true, "read binary")
+
+		FString WrittenJson, ReadJson;
+		VTC_MUST_EQUAL(Written.VulFieldSet().StreamToJson(WrittenJson), true, "written as json")
+		VTC_MUST_EQUAL(Read.VulFieldSet().StreamToJson(ReadJson), true, "read as json")
+		TC.Equal(*ReadJson, *WrittenJson, "round trip of all common types matches JSON");
+		TC.Equal(Read.Upper, FString("STR"), "interning is case sensitive");
+		TC.Equal(Read.Big, Written.Big, "int64");
+		TC.Equal(Binary.Num() < WrittenJson.Len(), true, "smaller than JSON");
+
+		// References are interned strings too.
+		FVulFieldTestSingleInstance Instance;
+		Instance.Int = 5;
+		Instance.Str = "foobar";
+		TArray<FVulFieldTestSingleInstance*> Refs = {&Instance, &Instance};
+		
+		Binary.Reset();
+		VTC_MUST_EQUAL(FVulField::Create(&Refs).StreamToBinary(Binary), true, "write refs")
+		
+		TArray<FVulFieldTestSingleInstance*> ReadRefs;
+		VTC_MUST_EQUAL(FVulField::Create(&ReadRefs).StreamFromBinary(Binary), true, "read refs")
+		
+		if (TC.Equal(ReadRefs.Num(), 2, "refs length"))
+		{
+			TC.Equal(ReadRefs[0], ReadRefs[1], "pointers same");
+		}
+
+		// Skipping unknown properties, with and without interned strings defined within them, and
+		// rewinding omitted empties that defined strings.
+		TMap<FString, FString> First = {{"x", "1"}}, Second = {{"x", "2"}}, Third = {{"y", ""}}, Fourth = {{"y", "4"}}, Fifth = First;
+		FVulFieldSet WriteSet;
+		WriteSet.Add(FVulField::Create(&First), "first");
+		WriteSet.Add(FVulField::Create(&Second), "second");
+		WriteSet.Add(FVulField::Create(&Third), "third");
+		WriteSet.Add(FVulField::Create(&Fourth), "fourth");
+		WriteSet.Add(FVulField::Create(&Fifth), "fifth");
+
+		Binary.Reset();
+		VTC_MUST_EQUAL(WriteSet.StreamToBinary(Binary), true, "write skippable")
+
+		TMap<FString, FString> ReadSecond, ReadFourth;
+		FVulFieldSet ReadSet;
+		ReadSet.Add(FVulField::Create(&ReadSecond), "second");
+		ReadSet.Add(FVulField::Create(&ReadFourth), "fourth");
+		
+		VTC_MUST_EQUAL(ReadSet.StreamFromBinary(Binary), true, "read skippable")
+		TC.Equal(ReadSecond, Second, "read after skipped string definitions");
+		TC.Equal(ReadFourth, Fourth, "read after rewound string definitions");
+
+		Binary.SetNum(Binary.Num() - 1);
+		TC.Equal(ReadSet.StreamFromBinary(Binary), false, "truncated input fails");
+
+		TArray<float> Floats = {1.5f};
+		Binary.Reset();
+		VTC_MUST_EQUAL(FVulField::Create(&Floats).StreamToBinary(Binary), true, "write float")
+		TC.Equal(TArray<uint8>(Binary.GetData(), 5), TArray<uint8>{'V', 'F', 'L', 'D', 1}, "magic and version");
+		TC.Equal(TArray<uint8>(Binary.GetData() + Binary.Num() - 4, 4), TArray<uint8>{0x00, 0x00, 0xC0, 0x3F}, "little-endian float");
+
+		TArray<float> ReadFloats;
+		Binary[4] = 2;
+		TC.Equal(FVulField::Create(&ReadFloats).StreamFromBinary(Binary), false, "other versions fail");
+		Binary[0] = '{';
+		TC.Equal(FVulField::Create(&ReadFloats).StreamFromBinary(Binary), false, "other data fails");
+	});
 	
 	return true;
 }
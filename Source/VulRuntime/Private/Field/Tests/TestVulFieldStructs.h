@@ -160,6 +160,11 @@ struct TVulFieldSerializer<TSharedPtr<FVulFieldTestTreeBase>>
 		return Value->VulFieldSet().Serialize(Out, Ctx);
 	}
 
+	static bool Serialize(const TSharedPtr<FVulFieldTestTreeBase>& Value, FVulFieldWriter& Out, FVulFieldSerializationContext& Ctx)
+	{
+		return Value->VulFieldSet().Serialize(Out, Ctx);
+	}
+
 	static bool Deserialize(const TSharedPtr<FJsonValue>& Data, TSharedPtr<FVulFieldTestTreeBase>& Out, FVulFieldDeserializationContext& Ctx)
 	{
 		TSharedPtr<FJsonValue> TypeStr;
@@ -295,6 +300,35 @@ struct FVulSingleFieldType
 	}
 };
 
+/**
+ * A registered type that serializes as another registered type.
+ */
+struct FVulFieldTestDelegating
+{
+	VULFLD_TYPE(FVulFieldTestDelegating, "VulFieldTestDelegating")
+
+	FVulFieldTestTreeNode1 Node;
+};
+
+template<>
+struct TVulFieldSerializer<FVulFieldTestDelegating>
+{
+	static bool Serialize(const FVulFieldTestDelegating& Value, TSharedPtr<FJsonValue>& Out, FVulFieldSerializationContext& Ctx)
+	{
+		return Ctx.Serialize(Value.Node, Out);
+	}
+
+	static bool Serialize(const FVulFieldTestDelegating& Value, FVulFieldWriter& Out, FVulFieldSerializationContext& Ctx)
+	{
+		return Ctx.Serialize(Value.Node, Out);
+	}
+
+	static bool Deserialize(const TSharedPtr<FJsonValue>& Data, FVulFieldTestDelegating& Out, FVulFieldDeserializationContext& Ctx)
+	{
+		return Ctx.Deserialize(Data, Out.Node);
+	}
+};
+
 inline bool CtxContainsError(VulTest::TC TC, const FVulFieldSerializationErrors& Errors, const FString& Term)
 {
 	for (const auto& Err : Errors.Errors)
@@ -1,5 +1,6 @@
 ﻿#include "TestCase.h"
 #include "Field/VulFieldUtil.h"
+#include "Field/VulFieldSerializationOptions.h"
 #include "Misc/AutomationTest.h"
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(
@@ -108,7 +109,144 @@ bool TestVulFieldUtil::RunTest(const FString& Parameters)
 			.Match = ".foo[9].bar.qux",
 			.ExpectedMatch = false,
 		});
+
+		Ddt.Run("no-match-index", Data{
+			.Path = {
+				VulRuntime::Field::FPathItem(TInPlaceType<FString>(), "foo"),
+				VulRuntime::Field::FPathItem(TInPlaceType<int>(), 1),
+			},
+			.Match = ".foo[01]",
+			.ExpectedMatch = false,
+		});
+
+		Ddt.Run("ancestor", Data{
+			.Path = {VulRuntime::Field::FPathItem(TInPlaceType<FString>(), "foo")},
+			.Match = ".foo.bar",
+			.ExpectedMatch = true,
+		});
+
+		Ddt.Run("root-ancestor", Data{
+			.Path = {},
+			.Match = ".foo",
+			.ExpectedMatch = true,
+		});
+
+		Ddt.Run("name-prefix", Data{
+			.Path = {VulRuntime::Field::FPathItem(TInPlaceType<FString>(), "foo")},
+			.Match = ".foobar",
+			.ExpectedMatch = true,
+		});
+
+		Ddt.Run("no-match-name-prefix", Data{
+			.Path = {
+				VulRuntime::Field::FPathItem(TInPlaceType<FString>(), "foo"),
+				VulRuntime::Field::FPathItem(TInPlaceType<FString>(), "bar"),
+			},
+			.Match = ".foobar.bar",
+			.ExpectedMatch = false,
+		});
+
+		Ddt.Run("ignores-case", Data{
+			.Path = {
+				VulRuntime::Field::FPathItem(TInPlaceType<FString>(), "Foo"),
+				VulRuntime::Field::FPathItem(TInPlaceType<int>(), 2),
+			},
+			.Match = ".foo[2]",
+			.ExpectedMatch = true,
+		});
+
+		Ddt.Run("invalid", Data{
+			.Path = {VulRuntime::Field::FPathItem(TInPlaceType<FString>(), "foo")},
+			.Match = "foo",
+			.ExpectedMatch = false,
+		});
 	}
 
+	const auto Prop = [](const FString& Name) { return VulRuntime::Field::FPathItem(TInPlaceType<FString>(), Name); };
+	const auto Index = [](const int I) { return VulRuntime::Field::FPathItem(TInPlaceType<int>(), I); };
+
+	VulTest::Case(this, "Path matcher", [&](VulTest::TC TC)
+	{
+		VulRuntime::Field::FPathMatcher Matcher;
+		TC.Equal(Matcher.Add(".foo.*"), 0, "first id");
+		TC.Equal(Matcher.Add(".foo.bar"), 1, "second id");
+		TC.Equal(Matcher.Add(".foo["), INDEX_NONE, "invalid pattern");
+		TC.Equal(Matcher.Add(".foo[*].baz"), 2, "ids skip invalid patterns");
+
+		const auto Matches = [&](const VulRuntime::Field::FPathMatcher::FState& State)
+		{
+			TArray<int32> Out;
+			Matcher.ForEachMatch(State, [&Out](const int32 Id) { Out.Add(Id); });
+			Out.Sort();
+			return Out;
+		};
+
+		VulRuntime::Field::FPathMatcher::FState Foo, FooBar, FooBarQux;
+		Matcher.Step(Matcher.Start(), Prop("foo"), Foo);
+		Matcher.Step(Foo, Prop("BAR"), FooBar);
+		Matcher.Step(FooBar, Prop("qux"), FooBarQux);
+
+		TC.Equal(Matches(Foo), TArray<int32>{0, 1, 2}, ".foo leads to all");
+		TC.Equal(Matches(FooBar), TArray<int32>{0, 1}, ".foo.bar");
+		TC.Equal(FooBarQux.IsEmpty(), true, ".foo.bar.qux cannot match");
+		TC.Equal(Matches(Matcher.Match({Prop("foo"), Index(3), Prop("baz")})), TArray<int32>{2}, ".foo[3].baz");
+		TC.Equal(Matches(Matcher.Match({Prop("foo"), Prop("baz")})), TArray<int32>{0}, "steps whole path");
+		TC.Equal(Matches(Matcher.Match({Prop("fo")})), TArray<int32>{0, 1, 2}, "name prefix");
+		TC.Equal(Matcher.Match({Prop("fo"), Prop("bar")}).IsEmpty(), true, "cannot step past a name prefix");
+	});
+
+	VulTest::Case(this, "Flag resolution", [&](VulTest::TC TC)
+	{
+		FVulFieldSerializationFlags Flags;
+		Flags.Set("test.flag", true, ".foo.*");
+		Flags.Set("test.flag", false, ".foo.bar");
+		Flags.Set("test.flag", false);
+		Flags.Set(VulFieldSerializationFlag_Referencing, false, ".foo.bar");
+
+		const VulRuntime::Field::FPath FooBar = {Prop("foo"), Prop("bar")};
+		
+		TC.Equal(Flags.IsEnabled("test.flag", FooBar), true, "first set path takes precedence");
+		TC.Equal(Flags.IsEnabled("test.flag", {Prop("foo")}), true, "applies on the way to a path");
+		TC.Equal(Flags.IsEnabled("test.flag", {Prop("qux")}), false, "unscoped");
+		TC.Equal(Flags.IsEnabled("test.unknown", FooBar), false, "unknown");
+		TC.Equal(Flags.IsEnabled(VulFieldSerializationFlag_Referencing, FooBar), false, "overrides default");
+		TC.Equal(Flags.IsEnabled(VulFieldSerializationFlag_Referencing, {}), false, "root leads to every path");
+		TC.Equal(Flags.IsEnabled(VulFieldSerializationFlag_Referencing, {Prop("qux")}), true, "default");
+
+		// Entered items are referenced, so must outlive their scopes.
+		const auto FooItem = Prop("foo");
+		const auto BarItem = Prop("bar");
+		const auto QuxItem = Prop("qux");
+		const TOptional<VulRuntime::Field::FPathItem> NoItem;
+
+		{
+			const auto Foo = Flags.Enter(FooItem);
+			const auto NoScope = Flags.Enter(NoItem);
+			TC.Equal(Flags.IsEnabled("test.flag"), true, "entered .foo");
+
+			{
+				const auto Bar = Flags.Enter(BarItem);
+				TC.Equal(Flags.IsEnabled("test.flag"), true, "entered .foo.bar");
+				TC.Equal(Flags.IsEnabled(VulFieldSerializationFlag_Referencing), false, "entered .foo.bar default");
+				TC.Equal(Flags.IsEnabled("test.flag", {Prop("qux")}), false, "shorter path whilst entered");
+				TC.Equal(
+					Flags.IsEnabled(VulFieldSerializationFlag_Referencing, {Prop("foo"), Prop("qux")}),
+					true,
+					"sibling path of the same depth whilst entered"
+				);
+			}
+
+			{
+				const auto Qux = Flags.Enter(QuxItem);
+				TC.Equal(Flags.IsEnabled(VulFieldSerializationFlag_Referencing), true, "entered .foo.qux");
+				Flags.Set(VulFieldSerializationFlag_Referencing, false, ".foo.qux");
+				TC.Equal(Flags.IsEnabled(VulFieldSerializationFlag_Referencing), false, "set whilst entered");
+			}
+		}
+
+		TC.Equal(Flags.IsEnabled(VulFieldSerializationFlag_Referencing), false, "left all");
+		TC.Equal(Flags.IsEnabled("test.flag"), true, "left all, root");
+	});
+
 	return true;
 }
@@ -14,6 +14,34 @@ bool FVulField::Deserialize(
 	return Write(Value, Ptr, Ctx, IdentifierCtx);
 }
 
+bool FVulField::Deserialize(
+	FVulFieldReader& In,
+	FVulFieldDeserializationContext& Ctx,
+	const TOptional<VulRuntime::Field::FPathItem>& IdentifierCtx
+) {
+	return StreamWrite(In, Ptr, Ctx, IdentifierCtx);
+}
+
+bool FVulField::StreamFromJson(const FString& JsonStr, FVulFieldDeserializationContext& Ctx)
+{
+	FVulFieldJsonReader Reader(JsonStr);
+	const auto Result = Deserialize(Reader, Ctx);
+
+	if (const auto Error = Reader.GetError(); Error.IsSet())
+	{
+		Ctx.State.Errors.Add(TEXT("cannot parse invalid JSON string: %s"), **Error);
+		return false;
+	}
+
+	return Result;
+}
+
+bool FVulField::StreamFromJson(const FString& JsonStr)
+{
+	FVulFieldDeserializationContext Ctx;
+	return StreamFromJson(JsonStr, Ctx);
+}
+
 bool FVulField::Serialize(TSharedPtr<FJsonValue>& Out) const
 {
 	FVulFieldSerializationContext Ctx;
@@ -28,6 +56,58 @@ bool FVulField::Serialize(
 	return Read(Ptr, Out, Ctx, IdentifierCtx);
 }
 
+bool FVulField::Serialize(
+	FVulFieldWriter& Out,
+	FVulFieldSerializationContext& Ctx,
+	const TOptional<VulRuntime::Field::FPathItem>& IdentifierCtx
+) const {
+	return Stream(Ptr, Out, Ctx, IdentifierCtx);
+}
+
+bool FVulField::StreamToJson(FString& Out, FVulFieldSerializationContext& Ctx) const
+{
+	FVulFieldJsonWriter Writer(Out);
+	return Serialize(Writer, Ctx);
+}
+
+bool FVulField::StreamToJson(FString& Out) const
+{
+	FVulFieldSerializationContext Ctx;
+	return StreamToJson(Out, Ctx);
+}
+
+bool FVulField::StreamToBinary(TArray<uint8>& Out, FVulFieldSerializationContext& Ctx) const
+{
+	FVulFieldBinaryWriter Writer(Out);
+	return Serialize(Writer, Ctx);
+}
+
+bool FVulField::StreamToBinary(TArray<uint8>& Out) const
+{
+	FVulFieldSerializationContext Ctx;
+	return StreamToBinary(Out, Ctx);
+}
+
+bool FVulField::StreamFromBinary(const TArrayView<const uint8> Data, FVulFieldDeserializationContext& Ctx)
+{
+	FVulFieldBinaryReader Reader(Data);
+	const auto Result = Deserialize(Reader, Ctx);
+
+	if (const auto Error = Reader.GetError(); Error.IsSet())
+	{
+		Ctx.State.Errors.Add(TEXT("cannot read invalid binary data: %s"), **Error);
+		return false;
+	}
+
+	return Result;
+}
+
+bool FVulField::StreamFromBinary(const TArrayView<const uint8> Data)
+{
+	FVulFieldDeserializationContext Ctx;
+	return StreamFromBinary(Data, Ctx);
+}
+
 bool FVulField::IsReadOnly() const
 {
 	return bIsReadOnly;
@@ -0,0 +1,316 @@
+﻿#include "Field/VulFieldBinaryReader.h"
+
+using namespace VulRuntime::Field::Binary;
+
+TOptional<FString> FVulFieldBinaryReader::GetError() const
+{
+	return Error;
+}
+
+EJson FVulFieldBinaryReader::Advance()
+{
+	if (Error.IsSet())
+	{
+		return EJson::None;
+	}
+
+	if (!Stack.IsEmpty())
+	{
+		const auto& Top = Stack.Last();
+		
+		if (Pos >= Top.End)
+		{
+			if (Pos > Top.End)
+			{
+				return Fail(TEXT("value overruns the length of its container"));
+			}
+			
+			Stack.Pop();
+			return EJson::None;
+		}
+
+		if (Top.bIsObject)
+		{
+			uint8 Tag;
+			if (!ReadBytes(&Tag, 1))
+			{
+				return EJson::None;
+			}
+
+			if (!ReadString(static_cast<ETag>(Tag), CurrentKey, CurrentKeyStorage))
+			{
+				return Fail(TEXT("expected a property name"));
+			}
+		} else
+		{
+			CurrentKey = FStringView();
+		}
+	} else if (bReadRoot)
+	{
+		if (Pos < Data.Num())
+		{
+			return Fail(TEXT("unexpected additional input"));
+		}
+		
+		return EJson::None;
+	} else if (!ReadHeader())
+	{
+		return EJson::None;
+	}
+
+	bReadRoot = true;
+	return ReadValue();
+}
+
+FStringView FVulFieldBinaryReader::GetKey() const
+{
+	return CurrentKey;
+}
+
+FStringView FVulFieldBinaryReader::GetString() const
+{
+	return CurrentString;
+}
+
+double FVulFieldBinaryReader::GetNumber() const
+{
+	return CurrentNumber;
+}
+
+bool FVulFieldBinaryReader::GetBool() const
+{
+	return CurrentBool;
+}
+
+bool FVulFieldBinaryReader::SkipContainer()
+{
+	// Values after this container may refer to strings it defines, so it must be read.
+	if (Stack.Last().bHasDefines)
+	{
+		return false;
+	}
+
+	Pos = Stack.Pop().End;
+	return true;
+}
+
+EJson FVulFieldBinaryReader::ReadValue()
+{
+	uint8 Tag;
+	if (!ReadBytes(&Tag, 1))
+	{
+		return EJson::None;
+	}
+
+	switch (static_cast<ETag>(Tag))
+	{
+	case ETag::Null:
+		return EJson::Null;
+	case ETag::False:
+	case ETag::True:
+		CurrentBool = static_cast<ETag>(Tag) == ETag::True;
+		return EJson::Boolean;
+	case ETag::Int:
+		{
+			uint64 Encoded;
+			if (!ReadVarint(Encoded))
+			{
+				return EJson::None;
+			}
+
+			CurrentNumber = static_cast<double>(static_cast<int64>(Encoded >> 1) ^ -static_cast<int64>(Encoded & 1));
+			return EJson::Number;
+		}
+	case ETag::Float:
+		{
+			uint64 Bits;
+			if (!ReadLittleEndian(Bits, sizeof(float)))
+			{
+				return EJson::None;
+			}
+
+			CurrentNumber = FMath::AsFloat(static_cast<uint32>(Bits));
+			return EJson::Number;
+		}
+	case ETag::Double:
+		{
+			uint64 Bits;
+			if (!ReadLittleEndian(Bits, sizeof(double)))
+			{
+				return EJson::None;
+			}
+
+			CurrentNumber = FMath::AsFloat(Bits);
+			return EJson::Number;
+		}
+	case ETag::String:
+	case ETag::StringDefine:
+	case ETag::StringRef:
+		return ReadString(static_cast<ETag>(Tag), CurrentString, CurrentStringStorage) ? EJson::String : EJson::None;
+	case ETag::Array:
+	case ETag::Object:
+	case ETag::ArrayWithDefines:
+	case ETag::ObjectWithDefines:
+		{
+			uint64 Length;
+			if (!ReadLittleEndian(Length, sizeof(uint32)))
+			{
+				return EJson::None;
+			}
+
+			const auto End = Pos + static_cast<int64>(Length);
+			if (End > Data.Num())
+			{
+				return Fail(TEXT("container length exceeds the input"));
+			}
+
+			const auto Type = static_cast<ETag>(Tag);
+			const bool bIsObject = Type == ETag::Object || Type == ETag::ObjectWithDefines;
+			
+			Stack.Push({
+				.End = End,
+				.bIsObject = bIsObject,
+				.bHasDefines = Type == ETag::ArrayWithDefines || Type == ETag::ObjectWithDefines,
+			});
+			
+			return bIsObject ? EJson::Object : EJson::Array;
+		}
+	default:
+		return Fail(FString::Printf(TEXT("unknown value tag %d"), Tag));
+	}
+}
+
+bool FVulFieldBinaryReader::ReadString(const ETag Tag, FStringView& Out, FString& Storage)
+{
+	if (Tag == ETag::StringRef)
+	{
+		uint64 Index;
+		if (!ReadVarint(Index))
+		{
+			return false;
+		}
+
+		if (Index >= static_cast<uint64>(Strings.Num()))
+		{
+			Fail(FString::Printf(TEXT("reference to undefined string %llu"), Index));
+			return false;
+		}
+
+		Out = Strings[Index];
+		return true;
+	}
+
+	if (Tag != ETag::String && Tag != ETag::StringDefine)
+	{
+		return false;
+	}
+
+	uint64 Length;
+	if (!ReadVarint(Length))
+	{
+		return false;
+	}
+
+	if (Length > static_cast<uint64>(Data.Num() - Pos))
+	{
+		Fail(TEXT("unexpected end of input"));
+		return false;
+	}
+
+	const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Data.GetData() + Pos), static_cast<int32>(Length));
+	Pos += Length;
+
+	auto& Target = Tag == ETag::StringDefine ? Strings.AddDefaulted_GetRef() : Storage;
+	Target = FString(Converted.Length(), Converted.Get());
+	Out = Target;
+	return true;
+}
+
+bool FVulFieldBinaryReader::ReadVarint(uint64& Out)
+{
+	Out = 0;
+
+	for (int32 Shift = 0; Shift < 64; Shift += 7)
+	{
+		uint8 Byte;
+		if (!ReadBytes(&Byte, 1))
+		{
+			return false;
+		}
+
+		Out |= static_cast<uint64>(Byte & 0x7F) << Shift;
+
+		if ((Byte & 0x80) == 0)
+		{
+			return true;
+		}
+	}
+
+	Fail(TEXT("malformed varint"));
+	return false;
+}
+
+bool FVulFieldBinaryReader::ReadLittleEndian(uint64& Out, const int32 NumBytes)
+{
+	uint8 Bytes[sizeof(uint64)];
+	if (!ReadBytes(Bytes, NumBytes))
+	{
+		return false;
+	}
+
+	Out = 0;
+
+	for (int32 Byte = 0; Byte < NumBytes; ++Byte)
+	{
+		Out |= static_cast<uint64>(Bytes[Byte]) << (Byte * 8);
+	}
+
+	return true;
+}
+
+bool FVulFieldBinaryReader::ReadHeader()
+{
+	uint64 ReadMagic;
+	uint8 ReadVersion;
+	if (!ReadLittleEndian(ReadMagic, sizeof(Magic)) || !ReadBytes(&ReadVersion, 1))
+	{
+		return false;
+	}
+
+	if (ReadMagic != Magic)
+	{
+		Fail(TEXT("not vul field binary data"));
+		return false;
+	}
+
+	if (ReadVersion != Version)
+	{
+		Fail(FString::Printf(TEXT("unsupported binary version %d, expected %d"), ReadVersion, Version));
+		return false;
+	}
+
+	return true;
+}
+
+bool FVulFieldBinaryReader::ReadBytes(void* Out, const int64 Num)
+{
+	if (Pos + Num > Data.Num())
+	{
+		Fail(TEXT("unexpected end of input"));
+		return false;
+	}
+
+	FMemory::Memcpy(Out, Data.GetData() + Pos, Num);
+	Pos += Num;
+	return true;
+}
+
+EJson FVulFieldBinaryReader::Fail(const FString& Message)
+{
+	if (!Error.IsSet())
+	{
+		Error = FString::Printf(TEXT("%s at byte %lld"), *Message, Pos);
+	}
+
+	return EJson::None;
+}
@@ -0,0 +1,190 @@
+﻿#include "Field/VulFieldBinaryWriter.h"
+
+using namespace VulRuntime::Field::Binary;
+
+FVulFieldBinaryWriter::FVulFieldBinaryWriter(TArray<uint8>& InOut) : Out(InOut)
+{
+	WriteLittleEndian(Magic, sizeof(Magic));
+	Out.Add(Version);
+}
+
+void FVulFieldBinaryWriter::WriteNull()
+{
+	WriteTag(ETag::Null);
+}
+
+void FVulFieldBinaryWriter::WriteBool(const bool Value)
+{
+	WriteTag(Value ? ETag::True : ETag::False);
+}
+
+void FVulFieldBinaryWriter::WriteInt(const int64 Value)
+{
+	WriteTag(ETag::Int);
+	// Zig-zag, so small negative numbers are small varints too.
+	WriteVarint((static_cast<uint64>(Value) << 1) ^ static_cast<uint64>(Value >> 63));
+}
+
+void FVulFieldBinaryWriter::WriteDouble(const double Value, const int32 Precision)
+{
+	auto Rounded = Value;
+
+	if (Precision != INDEX_NONE)
+	{
+		// Via text so rounding is exactly as FVulFieldJsonWriter's.
+		Rounded = FCString::Atod(*FString::Printf(TEXT("%.*f"), Precision, Value));
+	}
+
+	// Whole numbers that a double holds exactly are far smaller as varints.
+	if (FMath::Abs(Rounded) < 9007199254740992.0 && Rounded == FMath::TruncToDouble(Rounded))
+	{
+		WriteInt(static_cast<int64>(Rounded));
+		return;
+	}
+
+	if (static_cast<double>(static_cast<float>(Rounded)) == Rounded)
+	{
+		WriteTag(ETag::Float);
+		WriteLittleEndian(FMath::AsUInt(static_cast<float>(Rounded)), sizeof(float));
+		return;
+	}
+
+	WriteTag(ETag::Double);
+	WriteLittleEndian(FMath::AsUInt(Rounded), sizeof(double));
+}
+
+void FVulFieldBinaryWriter::WriteRawNumber(const FString& Value)
+{
+	WriteDouble(FCString::Atod(*Value), INDEX_NONE);
+}
+
+void FVulFieldBinaryWriter::WriteString(const FString& Value)
+{
+	WriteStringToken(Value, false);
+}
+
+void FVulFieldBinaryWriter::WriteBeginArray()
+{
+	BeginContainer(ETag::Array);
+}
+
+void FVulFieldBinaryWriter::WriteEndArray()
+{
+	EndContainer(ETag::ArrayWithDefines);
+}
+
+void FVulFieldBinaryWriter::WriteBeginObject()
+{
+	BeginContainer(ETag::Object);
+}
+
+void FVulFieldBinaryWriter::WriteEndObject()
+{
+	EndContainer(ETag::ObjectWithDefines);
+}
+
+void FVulFieldBinaryWriter::WriteKey(const FString& Name)
+{
+	WriteStringToken(Name, true);
+}
+
+void FVulFieldBinaryWriter::WriteSeparator()
+{
+	// Entries are delimited by their tags.
+}
+
+int64 FVulFieldBinaryWriter::GetPosition() const
+{
+	return Out.Num();
+}
+
+void FVulFieldBinaryWriter::Truncate(const int64 Position)
+{
+	Out.SetNum(static_cast<int32>(Position), EAllowShrinking::No);
+
+	// Strings defined in the discarded output must be defined again if written later.
+	while (!Definitions.IsEmpty() && Definitions.Last().Position >= Position)
+	{
+		Interned.Remove(Definitions.Pop().Value);
+	}
+}
+
+void FVulFieldBinaryWriter::WriteTag(const ETag Tag)
+{
+	Out.Add(static_cast<uint8>(Tag));
+}
+
+void FVulFieldBinaryWriter::WriteVarint(uint64 Value)
+{
+	while (Value >= 0x80)
+	{
+		Out.Add(static_cast<uint8>(Value | 0x80));
+		Value >>= 7;
+	}
+
+	Out.Add(static_cast<uint8>(Value));
+}
+
+void FVulFieldBinaryWriter::WriteLittleEndian(const uint64 Value, const int32 NumBytes)
+{
+	for (int32 Byte = 0; Byte < NumBytes; ++Byte)
+	{
+		Out.Add(static_cast<uint8>(Value >> (Byte * 8)));
+	}
+}
+
+void FVulFieldBinaryWriter::WriteUtf8(const FString& Value)
+{
+	const FTCHARToUTF8 Utf8(*Value, Value.Len());
+	WriteVarint(Utf8.Length());
+	Out.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+}
+
+void FVulFieldBinaryWriter::WriteStringToken(const FString& Value, const bool bAlwaysIntern)
+{
+	if (const auto Existing = Interned.Find(Value))
+	{
+		WriteTag(ETag::StringRef);
+		WriteVarint(*Existing);
+		return;
+	}
+
+	if (!bAlwaysIntern && Value.Len() > MaxInternedLength)
+	{
+		WriteTag(ETag::String);
+		WriteUtf8(Value);
+		return;
+	}
+
+	Interned.Add(Value, Definitions.Num());
+	Definitions.Add({.Value = Value, .Position = GetPosition()});
+	
+	WriteTag(ETag::StringDefine);
+	WriteUtf8(Value);
+}
+
+void FVulFieldBinaryWriter::BeginContainer(const ETag Tag)
+{
+	WriteTag(Tag);
+	Containers.Push({.Start = GetPosition(), .InternedNum = Definitions.Num()});
+
+	// The content length, filled in when the container ends.
+	Out.AddZeroed(sizeof(uint32));
+}
+
+void FVulFieldBinaryWriter::EndContainer(const ETag WithDefines)
+{
+	const auto Container = Containers.Pop();
+	const auto Start = static_cast<int32>(Container.Start);
+	const auto Length = static_cast<uint32>(GetPosition() - Container.Start - sizeof(uint32));
+
+	for (int32 Byte = 0; Byte < 4; ++Byte)
+	{
+		Out[Start + Byte] = static_cast<uint8>(Length >> (Byte * 8));
+	}
+
+	if (Definitions.Num() > Container.InternedNum)
+	{
+		Out[Start - 1] = static_cast<uint8>(WithDefines);
+	}
+}
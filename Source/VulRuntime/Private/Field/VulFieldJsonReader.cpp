@@ -0,0 +1,61 @@
+﻿#include "Field/VulFieldJsonReader.h"
+
+FVulFieldJsonReader::FVulFieldJsonReader(const FString& Json) : Reader(TJsonReaderFactory<TCHAR>::Create(Json))
+{
+}
+
+FVulFieldJsonReader::FVulFieldJsonReader(FArchive* const Archive) : Reader(TJsonReaderFactory<TCHAR>::Create(Archive))
+{
+}
+
+TOptional<FString> FVulFieldJsonReader::GetError() const
+{
+	if (const auto& Message = Reader->GetErrorMessage(); !Message.IsEmpty())
+	{
+		return Message;
+	}
+
+	return {};
+}
+
+EJson FVulFieldJsonReader::Advance()
+{
+	EJsonNotation Notation;
+	if (!Reader->ReadNext(Notation))
+	{
+		return EJson::None;
+	}
+
+	switch (Notation)
+	{
+	case EJsonNotation::ObjectStart: return EJson::Object;
+	case EJsonNotation::ArrayStart: return EJson::Array;
+	case EJsonNotation::Boolean: return EJson::Boolean;
+	case EJsonNotation::String: return EJson::String;
+	case EJsonNotation::Number: return EJson::Number;
+	case EJsonNotation::Null: return EJson::Null;
+	default:
+		// Container ends and errors; the latter are reported by GetError.
+		return EJson::None;
+	}
+}
+
+FStringView FVulFieldJsonReader::GetKey() const
+{
+	return Reader->GetIdentifier();
+}
+
+FStringView FVulFieldJsonReader::GetString() const
+{
+	return Reader->GetValueAsString();
+}
+
+double FVulFieldJsonReader::GetNumber() const
+{
+	return Reader->GetValueAsNumber();
+}
+
+bool FVulFieldJsonReader::GetBool() const
+{
+	return Reader->GetValueAsBoolean();
+}
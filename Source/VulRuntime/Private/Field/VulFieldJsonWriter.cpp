@@ -0,0 +1,113 @@
+﻿#include "Field/VulFieldJsonWriter.h"
+
+namespace
+{
+	/**
+	 * Appends Value as a quoted JSON string, escaping as FJsonSerializer does.
+	 */
+	void AppendJsonString(FString& Out, const FString& Value)
+	{
+		Out.AppendChar(TEXT('"'));
+
+		for (const TCHAR Char : Value)
+		{
+			switch (Char)
+			{
+			case TEXT('"'): Out.Append(TEXT("\\\"")); break;
+			case TEXT('\\'): Out.Append(TEXT("\\\\")); break;
+			case TEXT('\n'): Out.Append(TEXT("\\n")); break;
+			case TEXT('\t'): Out.Append(TEXT("\\t")); break;
+			case TEXT('\b'): Out.Append(TEXT("\\b")); break;
+			case TEXT('\f'): Out.Append(TEXT("\\f")); break;
+			case TEXT('\r'): Out.Append(TEXT("\\r")); break;
+			default:
+				if (Char < 0x20)
+				{
+					Out.Appendf(TEXT("\\u%04x"), Char);
+				} else
+				{
+					Out.AppendChar(Char);
+				}
+			}
+		}
+
+		Out.AppendChar(TEXT('"'));
+	}
+}
+
+void FVulFieldJsonWriter::WriteNull()
+{
+	Out.Append(TEXT("null"));
+}
+
+void FVulFieldJsonWriter::WriteBool(const bool Value)
+{
+	Out.Append(Value ? TEXT("true") : TEXT("false"));
+}
+
+void FVulFieldJsonWriter::WriteInt(const int64 Value)
+{
+	Out.Appendf(TEXT("%lld"), Value);
+}
+
+void FVulFieldJsonWriter::WriteDouble(const double Value, const int32 Precision)
+{
+	if (Precision == INDEX_NONE)
+	{
+		Out.Appendf(TEXT("%.17g"), Value);
+	} else
+	{
+		Out.Appendf(TEXT("%.*f"), Precision, Value);
+	}
+}
+
+void FVulFieldJsonWriter::WriteRawNumber(const FString& Value)
+{
+	Out.Append(Value);
+}
+
+void FVulFieldJsonWriter::WriteString(const FString& Value)
+{
+	AppendJsonString(Out, Value);
+}
+
+void FVulFieldJsonWriter::WriteBeginArray()
+{
+	Out.AppendChar(TEXT('['));
+}
+
+void FVulFieldJsonWriter::WriteEndArray()
+{
+	Out.AppendChar(TEXT(']'));
+}
+
+void FVulFieldJsonWriter::WriteBeginObject()
+{
+	Out.AppendChar(TEXT('{'));
+}
+
+void FVulFieldJsonWriter::WriteEndObject()
+{
+	Out.AppendChar(TEXT('}'));
+}
+
+void FVulFieldJsonWriter::WriteKey(const FString& Name)
+{
+	AppendJsonString(Out, Name);
+	Out.AppendChar(TEXT(':'));
+}
+
+void FVulFieldJsonWriter::WriteSeparator()
+{
+	Out.AppendChar(TEXT(','));
+}
+
+int64 FVulFieldJsonWriter::GetPosition() const
+{
+	return Out.Len();
+}
+
+void FVulFieldJsonWriter::Truncate(const int64 Position)
+{
+	Out.LeftInline(static_cast<int32>(Position), EAllowShrinking::No);
+}
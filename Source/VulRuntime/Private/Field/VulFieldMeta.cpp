@@ -439,7 +439,7 @@ TOptional<FString> FVulFieldDescription::GetTypeName() const
 {
 	if (TypeId.IsSet())
 	{
-		return FVulFieldRegistry::Get().GetType(TypeId.GetValue())->Name;
+		return FVulFieldRegistry::Get().Find(TypeId.GetValue())->Name;
 	}
 
 	return TOptional<FString>();
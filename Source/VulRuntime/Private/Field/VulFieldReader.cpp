@@ -0,0 +1,248 @@
+﻿#include "Field/VulFieldReader.h"
+
+EJson FVulFieldReader::Peek()
+{
+	if (!bStarted)
+	{
+		bStarted = true;
+		Current = Advance();
+	}
+
+	return Current;
+}
+
+FStringView FVulFieldReader::Key()
+{
+	Peek();
+	return Depth > 0 ? GetKey() : FStringView();
+}
+
+bool FVulFieldReader::Null()
+{
+	if (Peek() != EJson::Null)
+	{
+		return false;
+	}
+
+	Next();
+	return true;
+}
+
+bool FVulFieldReader::Bool(bool& Out)
+{
+	if (Peek() != EJson::Boolean)
+	{
+		return false;
+	}
+
+	Out = GetBool();
+	Next();
+	return true;
+}
+
+bool FVulFieldReader::Number(double& Out)
+{
+	if (Peek() != EJson::Number)
+	{
+		return false;
+	}
+
+	Out = GetNumber();
+	Next();
+	return true;
+}
+
+bool FVulFieldReader::String(FString& Out)
+{
+	if (Peek() != EJson::String)
+	{
+		return false;
+	}
+
+	Out = FString(GetString());
+	Next();
+	return true;
+}
+
+FStringView FVulFieldReader::StringView()
+{
+	return Peek() == EJson::String ? GetString() : FStringView();
+}
+
+bool FVulFieldReader::BeginArray()
+{
+	if (Peek() != EJson::Array)
+	{
+		return false;
+	}
+
+	Depth++;
+	Next();
+	return true;
+}
+
+bool FVulFieldReader::EndArray()
+{
+	return End();
+}
+
+bool FVulFieldReader::BeginObject()
+{
+	if (Peek() != EJson::Object)
+	{
+		return false;
+	}
+
+	Depth++;
+	Next();
+	return true;
+}
+
+bool FVulFieldReader::EndObject()
+{
+	return End();
+}
+
+bool FVulFieldReader::Skip()
+{
+	const auto Type = Peek();
+
+	if (Type == EJson::None)
+	{
+		return false;
+	}
+
+	if ((Type != EJson::Array && Type != EJson::Object) || SkipContainer())
+	{
+		Next();
+		return true;
+	}
+
+	const auto Outer = Depth;
+	Depth++;
+	Next();
+
+	while (Depth > Outer)
+	{
+		if (GetError().IsSet())
+		{
+			return false;
+		}
+
+		const auto Inner = Peek();
+
+		if (Inner == EJson::Array || Inner == EJson::Object)
+		{
+			if (!SkipContainer())
+			{
+				Depth++;
+			}
+			
+			Next();
+		} else if (Inner == EJson::None)
+		{
+			if (!End())
+			{
+				return false;
+			}
+		} else
+		{
+			Next();
+		}
+	}
+
+	return true;
+}
+
+bool FVulFieldReader::Json(TSharedPtr<FJsonValue>& Out)
+{
+	switch (Peek())
+	{
+	case EJson::Null:
+		Out = MakeShared<FJsonValueNull>();
+		return Null();
+	case EJson::Boolean:
+		{
+			bool Value;
+			Bool(Value);
+			Out = MakeShared<FJsonValueBoolean>(Value);
+			return true;
+		}
+	case EJson::Number:
+		{
+			double Value;
+			Number(Value);
+			Out = MakeShared<FJsonValueNumber>(Value);
+			return true;
+		}
+	case EJson::String:
+		{
+			FString Value;
+			String(Value);
+			Out = MakeShared<FJsonValueString>(Value);
+			return true;
+		}
+	case EJson::Array:
+		{
+			TArray<TSharedPtr<FJsonValue>> Items;
+			BeginArray();
+			
+			while (Peek() != EJson::None)
+			{
+				if (!Json(Items.AddDefaulted_GetRef()))
+				{
+					return false;
+				}
+			}
+			
+			Out = MakeShared<FJsonValueArray>(Items);
+			return EndArray();
+		}
+	case EJson::Object:
+		{
+			const auto Obj = MakeShared<FJsonObject>();
+			BeginObject();
+			
+			while (Peek() != EJson::None)
+			{
+				const FString Property(Key());
+				TSharedPtr<FJsonValue> Value;
+				
+				if (!Json(Value))
+				{
+					return false;
+				}
+				
+				Obj->SetField(Property, Value);
+			}
+			
+			Out = MakeShared<FJsonValueObject>(Obj);
+			return EndObject();
+		}
+	default:
+		return false;
+	}
+}
+
+FString FVulFieldReader::DescribeError() const
+{
+	return GetError().Get(TEXT("unexpected end of input"));
+}
+
+void FVulFieldReader::Next()
+{
+	Current = Advance();
+}
+
+bool FVulFieldReader::End()
+{
+	// The end of the container, rather than the end of input or an error.
+	if (Peek() != EJson::None || Depth == 0 || GetError().IsSet())
+	{
+		return false;
+	}
+
+	Depth--;
+	Next();
+	return true;
+}
@@ -23,19 +23,11 @@ TArray<FVulFieldRegistry::FEntry> FVulFieldRegistry::GetSubtypes(const FString&
 
 TOptional<FVulFieldRegistry::FEntry> FVulFieldRegistry::GetBaseType(const FString& TypeId) const
 {
-	const auto Type = GetType(TypeId);
-	if (!Type.IsSet())
+	const auto Type = Find(TypeId);
+	if (Type == nullptr || !Type->BaseType.IsSet())
 	{
 		return {};
 	}
 
-	for (const auto& Entry : Entries)
-	{
-		if (Type->BaseType == Entry.Value.TypeId)
-		{
-			return Entry.Value;
-		}
-	}
-
-	return {};
+	return GetType(Type->BaseType.GetValue());
 }
@@ -30,6 +30,22 @@ bool FVulFieldSerializationErrors::RequireJsonType(const TSharedPtr<FJsonValue>&
 	return true;
 }
 
+bool FVulFieldSerializationErrors::RequireJsonType(FVulFieldReader& In, const EJson Type)
+{
+	if (const auto Actual = In.Peek(); Actual != Type)
+	{
+		Add(
+			TEXT("Required JSON type %s, but got %s"),
+			*VulRuntime::Field::JsonTypeToString(Type),
+			*VulRuntime::Field::JsonTypeToString(Actual)
+		);
+		
+		return false;
+	}
+
+	return true;
+}
+
 bool FVulFieldSerializationErrors::RequireJsonProperty(
 	const TSharedPtr<FJsonValue>& Value,
 	const FString& Property,
@@ -58,7 +74,7 @@ bool FVulFieldSerializationErrors::RequireJsonProperty(
 	return true;
 }
 
-VulRuntime::Field::FPath FVulFieldSerializationErrors::GetPath() const
+const VulRuntime::Field::FPath& FVulFieldSerializationErrors::GetPath() const
 {
 	return Stack;
 }
@@ -114,16 +130,14 @@ FString FVulFieldSerializationErrors::PathStr() const
 	return VulRuntime::Field::PathStr(Stack);
 }
 
-TOptional<FString> FVulFieldSerializationContext::KnownTypeName(const FString& TypeId)
+const FString* FVulFieldSerializationContext::KnownTypeName(const uint64 TypeKey)
 {
-	const auto Entry = FVulFieldRegistry::Get().GetType(TypeId);
-
-	if (Entry.IsSet())
+	if (const auto Entry = FVulFieldRegistry::Get().Find(TypeKey))
 	{
-		return Entry->Name;
+		return &Entry->Name;
 	}
 
-	return {};
+	return nullptr;
 }
 
 bool FVulFieldSerializationContext::IsBaseType(const FString& TypeId)
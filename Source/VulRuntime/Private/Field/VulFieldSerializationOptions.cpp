@@ -14,36 +14,114 @@ void FVulFieldSerializationFlags::Set(const FString& Option, const bool Value, c
 	}
 
 	PathFlags[Path].Add(Option, Value);
+
+	// Recompiled in PathFlags order, so pattern IDs give precedence to paths that were set first.
+	const auto NewCompiled = MakeShared<FCompiled>();
+
+	for (const auto& Entry : PathFlags)
+	{
+		if (Entry.Key == "")
+		{
+			NewCompiled->Unscoped = Entry.Value;
+		} else if (NewCompiled->Matcher.Add(Entry.Key) != INDEX_NONE)
+		{
+			NewCompiled->PatternFlags.Add(Entry.Value);
+		}
+	}
+
+	Compiled = NewCompiled;
+
+	// Anything already entered belongs to the old matcher, so is stepped through again.
+	for (int32 I = 0; I < Entered.Num(); ++I)
+	{
+		Compiled->Matcher.Step(I == 0 ? Compiled->Matcher.Start() : Entered[I - 1].State, *Entered[I].Item, Entered[I].State);
+	}
 }
 
 bool FVulFieldSerializationFlags::IsEnabled(const FString& Option, const VulRuntime::Field::FPath& Path) const
 {
-	return Resolve(Option, Path);
+	return Resolve(Option, Compiled.IsValid() ? Compiled->Matcher.Match(Path) : VulRuntime::Field::FPathMatcher::FState());
 }
 
-bool FVulFieldSerializationFlags::Resolve(const FString& Option, const VulRuntime::Field::FPath& Path) const
+bool FVulFieldSerializationFlags::IsEnabled(const FString& Option) const
 {
-	for (const auto& Entry : PathFlags)
+	if (!Compiled.IsValid())
 	{
-		if (Entry.Key == "")
+		return Resolve(Option, {});
+	}
+
+	return Resolve(Option, Entered.IsEmpty() ? Compiled->Matcher.Start() : Entered.Last().State);
+}
+
+FVulFieldSerializationFlags::FScope::~FScope()
+{
+	if (Flags != nullptr)
+	{
+		Flags->Entered.Pop(EAllowShrinking::No);
+	}
+}
+
+FVulFieldSerializationFlags::FScope FVulFieldSerializationFlags::Enter(const TOptional<VulRuntime::Field::FPathItem>& Item)
+{
+	if (!Item.IsSet())
+	{
+		return FScope(nullptr);
+	}
+
+	return Enter(Item.GetValue());
+}
+
+FVulFieldSerializationFlags::FScope FVulFieldSerializationFlags::Enter(const VulRuntime::Field::FPathItem& Item)
+{
+	// Items are tracked without compiled paths too, in case paths are set mid-traversal.
+	auto& Added = Entered.Add_GetRef({.Item = &Item});
+
+	if (Compiled.IsValid())
+	{
+		const auto& Previous = Entered.Num() > 1 ? Entered[Entered.Num() - 2].State : Compiled->Matcher.Start();
+		Compiled->Matcher.Step(Previous, Item, Added.State);
+	}
+	
+	return FScope(this);
+}
+
+bool FVulFieldSerializationFlags::Resolve(
+	const FString& Option,
+	const VulRuntime::Field::FPathMatcher::FState& State
+) const {
+	if (Compiled.IsValid())
+	{
+		int32 BestId = INDEX_NONE;
+		bool Value = false;
+
+		Compiled->Matcher.ForEachMatch(State, [&](const int32 Id)
 		{
-			continue;
-		}
-		
-		if (Entry.Value.Contains(Option) && VulRuntime::Field::PathMatch(Path, Entry.Key))
+			if (BestId != INDEX_NONE && BestId < Id)
+			{
+				return;
+			}
+			
+			if (const auto Found = Compiled->PatternFlags[Id].Find(Option))
+			{
+				BestId = Id;
+				Value = *Found;
+			}
+		});
+
+		if (BestId != INDEX_NONE)
 		{
-			return Entry.Value[Option];
+			return Value;
 		}
-	}
 
-	if (PathFlags.Contains("") && PathFlags[""].Contains(Option))
-	{
-		return PathFlags[""][Option];
+		if (const auto Found = Compiled->Unscoped.Find(Option))
+		{
+			return *Found;
+		}
 	}
 	
-	if (GlobalDefaults.Contains(Option))
+	if (const auto Found = GlobalDefaults.Find(Option))
 	{
-		return GlobalDefaults[Option];
+		return *Found;
 	}
 
 	return false;
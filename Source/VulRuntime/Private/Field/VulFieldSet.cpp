@@ -143,6 +143,90 @@ bool FVulFieldSet::Serialize(TSharedPtr<FJsonValue>& Out, FVulFieldSerialization
 	return true;
 }
 
+bool FVulFieldSet::Serialize(FVulFieldWriter& Out, FVulFieldSerializationContext& Ctx) const
+{
+	if (!IsValid())
+	{
+		Out.Null();
+		return true;
+	}
+
+	Out.BeginObject();
+	
+	for (const auto& Entry : Entries)
+	{
+		// Whether a value is empty is only known once written, so empty values are rewound.
+		const auto Mark = Out.GetMark();
+		Out.Key(Entry.Key);
+		
+		if (Entry.Value.StreamFn != nullptr)
+		{
+			if (!Entry.Value.StreamFn(Out, Ctx, VulRuntime::Field::FPathItem(TInPlaceType<FString>(), Entry.Key)))
+			{
+				return false;
+			}
+		} else
+		{
+			if (!Entry.Value.Field.Serialize(Out, Ctx, VulRuntime::Field::FPathItem(TInPlaceType<FString>(), Entry.Key)))
+			{
+				return false;
+			}
+		}
+
+		if (Entry.Value.OmitIfEmpty && Out.WasEmpty())
+		{
+			Out.Rewind(Mark);
+		}
+	}
+
+	Out.EndObject();
+	return true;
+}
+
+bool FVulFieldSet::StreamToJson(FString& Out, FVulFieldSerializationContext& Ctx) const
+{
+	FVulFieldJsonWriter Writer(Out);
+	return Serialize(Writer, Ctx);
+}
+
+bool FVulFieldSet::StreamToJson(FString& Out) const
+{
+	FVulFieldSerializationContext Ctx;
+	return StreamToJson(Out, Ctx);
+}
+
+bool FVulFieldSet::StreamToBinary(TArray<uint8>& Out, FVulFieldSerializationContext& Ctx) const
+{
+	FVulFieldBinaryWriter Writer(Out);
+	return Serialize(Writer, Ctx);
+}
+
+bool FVulFieldSet::StreamToBinary(TArray<uint8>& Out) const
+{
+	FVulFieldSerializationContext Ctx;
+	return StreamToBinary(Out, Ctx);
+}
+
+bool FVulFieldSet::StreamFromBinary(const TArrayView<const uint8> Data, FVulFieldDeserializationContext& Ctx)
+{
+	FVulFieldBinaryReader Reader(Data);
+	const auto Result = Deserialize(Reader, Ctx);
+
+	if (const auto Error = Reader.GetError(); Error.IsSet())
+	{
+		Ctx.State.Errors.Add(TEXT("cannot read invalid binary data: %s"), **Error);
+		return false;
+	}
+
+	return Result;
+}
+
+bool FVulFieldSet::StreamFromBinary(const TArrayView<const uint8> Data)
+{
+	FVulFieldDeserializationContext Ctx;
+	return StreamFromBinary(Data, Ctx);
+}
+
 bool FVulFieldSet::Deserialize(const TSharedPtr<FJsonValue>& Data)
 {
 	FVulFieldDeserializationContext Ctx;
@@ -175,6 +259,60 @@ bool FVulFieldSet::Deserialize(const TSharedPtr<FJsonValue>& Data, FVulFieldDese
 	return true;
 }
 
+bool FVulFieldSet::Deserialize(FVulFieldReader& In, FVulFieldDeserializationContext& Ctx)
+{
+	if (!In.BeginObject())
+	{
+		return false;
+	}
+
+	while (In.Peek() != EJson::None)
+	{
+		const auto Key = In.Key();
+
+		// Looked up by the view's hash, which matches FString's case-insensitive hash, so finding
+		// an entry allocates nothing and does not depend on the order keys arrive in.
+		FEntry* Match = Entries.FindByHash(GetTypeHash(Key), Key);
+		
+		if (Match == nullptr || Match->Fn != nullptr || Match->Field.IsReadOnly())
+		{
+			if (!Ctx.State.Errors.AddIfNot(In.Skip(), TEXT("cannot read value: %s"), *In.DescribeError()))
+			{
+				return false;
+			}
+			
+			continue;
+		}
+
+		if (!Match->Field.Deserialize(In, Ctx, VulRuntime::Field::FPathItem(TInPlaceType<FString>(), FString(Key))))
+		{
+			return false;
+		}
+	}
+
+	return Ctx.State.Errors.AddIfNot(In.EndObject(), TEXT("cannot read object: %s"), *In.DescribeError());
+}
+
+bool FVulFieldSet::StreamFromJson(const FString& JsonStr, FVulFieldDeserializationContext& Ctx)
+{
+	FVulFieldJsonReader Reader(JsonStr);
+	const auto Result = Deserialize(Reader, Ctx);
+
+	if (const auto Error = Reader.GetError(); Error.IsSet())
+	{
+		Ctx.State.Errors.Add(TEXT("cannot parse invalid JSON string: %s"), **Error);
+		return false;
+	}
+
+	return Result;
+}
+
+bool FVulFieldSet::StreamFromJson(const FString& JsonStr)
+{
+	FVulFieldDeserializationContext Ctx;
+	return StreamFromJson(JsonStr, Ctx);
+}
+
 bool FVulFieldSet::Describe(FVulFieldSerializationContext& Ctx, TSharedPtr<FVulFieldDescription>& Description) const
 {
 	for (const auto& Entry : Entries)
@@ -1,4 +1,5 @@
 ﻿#include "Field/VulFieldUtil.h"
+#include "Hash/CityHash.h"
 
 bool VulRuntime::Field::IsEmpty(const TSharedPtr<FJsonValue>& Value)
 {
@@ -66,72 +67,228 @@ FString VulRuntime::Field::PathStr(const TArray<FPathItem>& Path)
 
 bool VulRuntime::Field::PathMatch(const FPath& Path, const FString& Match)
 {
-	if (Match.IsEmpty())
+	FPathMatcher Matcher;
+	
+	if (Matcher.Add(Match) == INDEX_NONE)
 	{
 		return false;
 	}
+
+	bool Matched = false;
+	Matcher.ForEachMatch(Matcher.Match(Path), [&Matched](const int32) { Matched = true; });
 	
-	int StrIndex = 0;
-	
-	for (const auto& Item : Path)
+	return Matched;
+}
+
+int32 VulRuntime::Field::FPathMatcher::Add(const FString& Pattern)
+{
+	enum class EToken : uint8 { Property, AnyProperty, Index, AnyIndex };
+
+	struct FToken
 	{
-		if (Match.Len() - 1 < StrIndex)
-		{
-			// More items that the path. Cannot match.
-			return false;
-		}
-		
-		if (Item.IsType<FString>() && Match[StrIndex] == '.')
+		EToken Type;
+		FString Property = {};
+		int Index = 0;
+	};
+
+	// Indices are compared as they're written, so ones like "[01]" can never match.
+	constexpr int NeverIndex = TNumericLimits<int>::Min();
+
+	if (Pattern.IsEmpty())
+	{
+		return INDEX_NONE;
+	}
+
+	// Parse the whole pattern first so an invalid one leaves nothing behind in the trie.
+	TArray<FToken, TInlineAllocator<8>> Tokens;
+	const int32 Len = Pattern.Len();
+	int32 I = Pattern == TEXT(".") ? Len : 0;
+
+	while (I < Len)
+	{
+		if (Pattern[I] == TEXT('.'))
 		{
-			StrIndex++;
+			I++;
 			
-			if (Match[StrIndex] == TEXT('*'))
+			if (I < Len && Pattern[I] == TEXT('*'))
 			{
-				StrIndex++;
+				Tokens.Add({EToken::AnyProperty});
+				I++;
 				continue;
 			}
 
-			const auto Part = Item.Get<FString>();
+			const auto Start = I;
+			
+			while (I < Len && Pattern[I] != TEXT('.') && Pattern[I] != TEXT('['))
+			{
+				I++;
+			}
 
-			if (Match.Mid(StrIndex, Part.Len()) == Part)
+			if (I == Start)
 			{
-				StrIndex += Part.Len();
+				return INDEX_NONE;
+			}
+			
+			Tokens.Add({EToken::Property, Pattern.Mid(Start, I - Start)});
+		} else if (Pattern[I] == TEXT('['))
+		{
+			I++;
+
+			if (I + 1 < Len && Pattern[I] == TEXT('*') && Pattern[I + 1] == TEXT(']'))
+			{
+				Tokens.Add({EToken::AnyIndex});
+				I += 2;
 				continue;
 			}
-		} else if (Item.IsType<int>())
+
+			const auto Start = I;
+
+			while (I < Len && FChar::IsDigit(Pattern[I]))
+			{
+				I++;
+			}
+
+			if (I == Start || I == Len || Pattern[I] != TEXT(']'))
+			{
+				return INDEX_NONE;
+			}
+
+			const auto Digits = Pattern.Mid(Start, I - Start);
+			const auto Value = FCString::Atoi64(*Digits);
+			const bool bCanonical = Digits.Len() <= 10 && (Digits.Len() == 1 || Digits[0] != TEXT('0')) && Value <= MAX_int32;
+			
+			Tokens.Add({EToken::Index, {}, bCanonical ? static_cast<int>(Value) : NeverIndex});
+			I++;
+		} else
+		{
+			return INDEX_NONE;
+		}
+	}
+
+	if (Nodes.IsEmpty())
+	{
+		Nodes.AddDefaulted();
+	}
+
+	int32 Node = 0;
+	Nodes[Node].Patterns.Add(NextId);
+	
+	for (const auto& Token : Tokens)
+	{
+		int32* Edge = nullptr;
+		
+		switch (Token.Type)
 		{
-			if (Match[StrIndex] == TEXT('['))
+		case EToken::Property: Edge = &Nodes[Node].Properties.FindOrAdd(Token.Property, INDEX_NONE); break;
+		case EToken::AnyProperty: Edge = &Nodes[Node].AnyProperty; break;
+		case EToken::Index: Edge = &Nodes[Node].Indices.FindOrAdd(Token.Index, INDEX_NONE); break;
+		case EToken::AnyIndex: Edge = &Nodes[Node].AnyIndex; break;
+		}
+
+		// Link before adding the new node, as adding may move the node that Edge points in to.
+		if (*Edge == INDEX_NONE)
+		{
+			const auto Child = Nodes.Num();
+			*Edge = Child;
+
+			if (Token.Type == EToken::Property)
 			{
-				StrIndex++;
-				if (Match[StrIndex] == TEXT('*') && Match[StrIndex + 1] == TEXT(']'))
+				for (int32 PrefixLen = 0; PrefixLen < Token.Property.Len(); ++PrefixLen)
 				{
-					StrIndex += 2;
-					continue;
+					Nodes[Node].Prefixes.FindOrAdd(Token.Property.Left(PrefixLen)).Add(~Child);
 				}
+			}
+
+			Node = Nodes.AddDefaulted();
+		} else
+		{
+			Node = *Edge;
+		}
 
-				FString NumericCharacters;
+		Nodes[Node].Patterns.Add(NextId);
+	}
 
-				while (FChar::IsDigit(Match[StrIndex]))
-				{
-					NumericCharacters += Match[StrIndex];
-					StrIndex++;
-				}
+	return NextId++;
+}
 
-				if (Match[StrIndex] == TEXT(']'))
-				{
-					StrIndex++;
-					if (FString::FromInt(Item.Get<int>()) == NumericCharacters)
-					{
-						continue;
-					}
-				}
+VulRuntime::Field::FPathMatcher::FState VulRuntime::Field::FPathMatcher::Start() const
+{
+	FState Out;
+	
+	if (!Nodes.IsEmpty())
+	{
+		Out.Add(0);
+	}
+	
+	return Out;
+}
+
+void VulRuntime::Field::FPathMatcher::Step(const FState& From, const FPathItem& Item, FState& Out) const
+{
+	Out.Reset();
+
+	for (const auto Index : From)
+	{
+		if (Index < 0)
+		{
+			// Reached by a partial property name.
+			continue;
+		}
+		
+		const auto& Node = Nodes[Index];
+		
+		if (Item.IsType<FString>())
+		{
+			const auto& Name = Item.Get<FString>();
+			
+			if (const auto Next = Node.Properties.Find(Name))
+			{
+				Out.Add(*Next);
+			}
+
+			if (const auto Partial = Node.Prefixes.Find(Name))
+			{
+				Out.Append(*Partial);
+			}
+
+			if (Node.AnyProperty != INDEX_NONE)
+			{
+				Out.Add(Node.AnyProperty);
+			}
+		} else if (Item.IsType<int>())
+		{
+			const auto ItemIndex = Item.Get<int>();
+			
+			if (const auto Next = ItemIndex >= 0 ? Node.Indices.Find(ItemIndex) : nullptr)
+			{
+				Out.Add(*Next);
+			}
+
+			if (Node.AnyIndex != INDEX_NONE)
+			{
+				Out.Add(Node.AnyIndex);
 			}
 		}
+	}
+}
 
-		return false;
+VulRuntime::Field::FPathMatcher::FState VulRuntime::Field::FPathMatcher::Match(const FPath& Path) const
+{
+	FState State = Start();
+	FState Next;
+
+	for (const auto& Item : Path)
+	{
+		if (State.IsEmpty())
+		{
+			break;
+		}
+		
+		Step(State, Item, Next);
+		Swap(State, Next);
 	}
 
-	return true;
+	return State;
 }
 
 FString VulRuntime::Field::JsonTypeToString(const EJson Type)
@@ -148,3 +305,8 @@ FString VulRuntime::Field::JsonTypeToString(const EJson Type)
 	default: return TEXT("Unknown");
 	}
 }
+
+uint64 VulRuntime::Field::TypeKey(const FString& TypeId)
+{
+	return CityHash64(reinterpret_cast<const char*>(*TypeId), TypeId.Len() * sizeof(TCHAR));
+}
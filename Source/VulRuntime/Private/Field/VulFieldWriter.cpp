@@ -0,0 +1,217 @@
+﻿#include "Field/VulFieldWriter.h"
+
+void FVulFieldWriter::Null()
+{
+	BeginValue();
+	WriteNull();
+	EndValue(true);
+}
+
+void FVulFieldWriter::Bool(const bool Value)
+{
+	BeginValue();
+	WriteBool(Value);
+	EndValue(false);
+}
+
+void FVulFieldWriter::Int(const int64 Value)
+{
+	BeginValue();
+	WriteInt(Value);
+	EndValue(false);
+}
+
+void FVulFieldWriter::Double(const double Value, const int32 Precision)
+{
+	BeginValue();
+	WriteDouble(Value, Precision);
+	EndValue(false);
+}
+
+void FVulFieldWriter::RawNumber(const FString& Value)
+{
+	BeginValue();
+	WriteRawNumber(Value);
+	EndValue(false);
+}
+
+void FVulFieldWriter::String(const FString& Value)
+{
+	BeginValue();
+	WriteString(Value);
+	EndValue(Value.IsEmpty());
+}
+
+void FVulFieldWriter::BeginArray()
+{
+	BeginValue();
+	WriteBeginArray();
+	Stack.Push({.bIsObject = false});
+}
+
+void FVulFieldWriter::EndArray()
+{
+	checkf(!Stack.IsEmpty() && !Stack.Last().bIsObject, TEXT("EndArray called outside of an array"))
+
+	WriteEndArray();
+	EndValue(Stack.Pop().bAllEmpty);
+}
+
+void FVulFieldWriter::BeginObject()
+{
+	auto Annotation = BeginValue();
+	WriteBeginObject();
+	Stack.Push({.bIsObject = true, .Annotation = MoveTemp(Annotation)});
+}
+
+void FVulFieldWriter::EndObject()
+{
+	checkf(!Stack.IsEmpty() && Stack.Last().bIsObject, TEXT("EndObject called outside of an object"))
+	checkf(!bAfterKey, TEXT("EndObject called after a Key without a value"))
+
+	if (Stack.Last().Annotation.IsSet())
+	{
+		const auto TypeName = Stack.Last().Annotation.GetValue();
+		Key(TEXT("VulType"));
+		String(TypeName);
+	}
+
+	WriteEndObject();
+	EndValue(Stack.Pop().bAllEmpty);
+}
+
+void FVulFieldWriter::Key(const FString& Name)
+{
+	checkf(!Stack.IsEmpty() && Stack.Last().bIsObject, TEXT("Key called outside of an object"))
+	checkf(!bAfterKey, TEXT("Key called after a Key without a value"))
+
+	if (Stack.Last().Num++ > 0)
+	{
+		WriteSeparator();
+	}
+
+	WriteKey(Name);
+	bAfterKey = true;
+}
+
+void FVulFieldWriter::Json(const TSharedPtr<FJsonValue>& Value)
+{
+	if (!Value.IsValid())
+	{
+		Null();
+		return;
+	}
+
+	switch (Value->Type)
+	{
+	case EJson::Boolean:
+		Bool(Value->AsBool());
+		break;
+	case EJson::Number:
+		// Keeps the formatting of FJsonValueNumberString.
+		RawNumber(Value->AsString());
+		break;
+	case EJson::String:
+		String(Value->AsString());
+		break;
+	case EJson::Array:
+		BeginArray();
+		for (const auto& Item : Value->AsArray())
+		{
+			Json(Item);
+		}
+		EndArray();
+		break;
+	case EJson::Object:
+		BeginObject();
+		for (const auto& Entry : Value->AsObject()->Values)
+		{
+			Key(FString(GetNum(Entry.Key), GetData(Entry.Key)));
+			Json(Entry.Value);
+		}
+		EndObject();
+		break;
+	default:
+		Null();
+	}
+}
+
+void FVulFieldWriter::AnnotateNextObject(const FString& TypeName)
+{
+	if (PendingAnnotation.IsSet() && PendingAnnotationDepth == Stack.Num())
+	{
+		return;
+	}
+
+	PendingAnnotation = TypeName;
+	PendingAnnotationDepth = Stack.Num();
+}
+
+FVulFieldWriter::FMark FVulFieldWriter::GetMark() const
+{
+	FMark Out;
+	Out.Position = GetPosition();
+	Out.Depth = Stack.Num();
+
+	if (!Stack.IsEmpty())
+	{
+		Out.Num = Stack.Last().Num;
+		Out.bAllEmpty = Stack.Last().bAllEmpty;
+	}
+
+	return Out;
+}
+
+void FVulFieldWriter::Rewind(const FMark& Mark)
+{
+	checkf(Mark.Depth == Stack.Num(), TEXT("Cannot rewind a field writer to a different depth"))
+
+	Truncate(Mark.Position);
+
+	if (!Stack.IsEmpty())
+	{
+		Stack.Last().Num = Mark.Num;
+		Stack.Last().bAllEmpty = Mark.bAllEmpty;
+	}
+
+	bAfterKey = false;
+	PendingAnnotation.Reset();
+}
+
+TOptional<FString> FVulFieldWriter::BeginValue()
+{
+	TOptional<FString> Annotation;
+
+	// An annotation is only for the very next value at its depth, which may not be an object.
+	if (PendingAnnotation.IsSet() && PendingAnnotationDepth == Stack.Num())
+	{
+		Annotation = MoveTemp(PendingAnnotation);
+		PendingAnnotation.Reset();
+	}
+
+	if (Stack.IsEmpty())
+	{
+		return Annotation;
+	}
+
+	if (auto& Top = Stack.Last(); Top.bIsObject)
+	{
+		checkf(bAfterKey, TEXT("Values in an object must follow a Key"))
+		bAfterKey = false;
+	} else if (Top.Num++ > 0)
+	{
+		WriteSeparator();
+	}
+
+	return Annotation;
+}
+
+void FVulFieldWriter::EndValue(const bool bEmpty)
+{
+	bLastEmpty = bEmpty;
+
+	if (!Stack.IsEmpty())
+	{
+		Stack.Last().bAllEmpty &= bEmpty;
+	}
+}
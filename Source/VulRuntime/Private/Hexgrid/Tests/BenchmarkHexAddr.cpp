@@ -0,0 +1,85 @@
+﻿#include "Benchmark.h"
+#include "Hexgrid/VulHexgrid.h"
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	BenchmarkHexAddr,
+	"VulRuntime.Hexgrid.BenchmarkHexAddr",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter
+)
+
+namespace
+{
+	/**
+	 * An address hashed the way FVulHexAddr used to be: a CRC over all of Q, R and S.
+	 */
+	struct FCrcHashedAddr
+	{
+		FVulHexAddr Addr;
+
+		bool operator==(const FCrcHashedAddr& Other) const
+		{
+			return Addr.Q == Other.Addr.Q && Addr.R == Other.Addr.R && Addr.S == Other.Addr.S;
+		}
+
+		friend uint32 GetTypeHash(const FCrcHashedAddr& Key)
+		{
+			return FCrc::MemCrc32(&Key.Addr, sizeof(FVulHexAddr));
+		}
+	};
+
+	template <typename KeyType>
+	int64 MapWorkload(const TArray<KeyType>& Keys)
+	{
+		TMap<KeyType, int32> Map;
+		Map.Reserve(Keys.Num());
+
+		for (int32 I = 0; I < Keys.Num(); ++I)
+		{
+			Map.Add(Keys[I], I);
+		}
+
+		int64 Sum = 0;
+
+		for (int Pass = 0; Pass < 4; ++Pass)
+		{
+			for (const auto& Key : Keys)
+			{
+				Sum += Map.FindChecked(Key);
+			}
+		}
+
+		return Sum;
+	}
+}
+
+bool BenchmarkHexAddr::RunTest(const FString& Parameters)
+{
+	const auto Addrs = FVulHexAddr::GenerateGrid(40);
+
+	TArray<FCrcHashedAddr> CrcKeys;
+	TArray<FVulHexKey> PackedKeys;
+
+	for (const auto& Addr : Addrs)
+	{
+		CrcKeys.Add({Addr});
+		PackedKeys.Add(FVulHexKey(Addr));
+	}
+
+	int64 Checksum = 0;
+
+	const auto Crc = VulTest::Benchmark(this, TEXT("TMap, CRC-hashed addr"), 20, [&] { Checksum += MapWorkload(CrcKeys); });
+	const auto Addr = VulTest::Benchmark(this, TEXT("TMap, FVulHexAddr"), 20, [&] { Checksum += MapWorkload(Addrs); });
+	const auto Key = VulTest::Benchmark(this, TEXT("TMap, FVulHexKey"), 20, [&] { Checksum += MapWorkload(PackedKeys); });
+
+	VulTest::LogSpeedup(this, Crc, Addr);
+	VulTest::LogSpeedup(this, Crc, Key);
+
+	// Paths returns a map keyed by address, with an entry per reachable tile.
+	const TVulHexgrid<int> Grid(30, [](const FVulHexAddr&) { return 0; });
+	VulTest::Benchmark(this, TEXT("TVulHexgrid::Paths"), 20, [&] { Checksum += Grid.Paths(FVulHexAddr::Origin()).Num(); });
+
+	TestTrue(TEXT("Workloads ran"), Checksum > 0);
+
+	return true;
+}
@@ -0,0 +1,170 @@
+﻿#include "Benchmark.h"
+#include "Hexgrid/VulHexgrid.h"
+#include "Hexgrid/VulHexNeighbourhood.h"
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	BenchmarkHexNeighbourhood,
+	"VulRuntime.Hexgrid.BenchmarkHexNeighbourhood",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter
+)
+
+namespace
+{
+	typedef TVulHexgrid<int> FBenchGrid;
+
+	/**
+	 * Rings generated the way FVulHexAddr::GenerateRing used to: from an intermediate sequence
+	 * with modulo indexing.
+	 */
+	TArray<int> LegacySequenceForRing(const int Ring)
+	{
+		auto AtLimitFor = 0;
+		auto Current = 0;
+		auto Direction = -1;
+		TArray<int> Out;
+
+		do
+		{
+			auto New = FMath::Clamp(Current, -Ring, Ring);
+			Out.Add(New);
+
+			if (New == -Ring || New == Ring)
+			{
+				if (++AtLimitFor > Ring)
+				{
+					Direction *= -1;
+					Current = New;
+				}
+			} else
+			{
+				AtLimitFor = 0;
+			}
+
+			Current += Direction;
+		} while (Out.Num() < Ring * 6);
+
+		return Out;
+	}
+
+	TArray<FVulHexAddr> LegacyGenerateGrid(const int Size)
+	{
+		TArray<FVulHexAddr> Out;
+		Out.Add(FVulHexAddr(0, 0));
+
+		for (auto N = 1; N <= Size; N++)
+		{
+			const auto Seq = LegacySequenceForRing(N);
+
+			auto Q = 0;
+			auto R = Seq.Num() - N * 2;
+
+			for (auto I = 0; I < N * 6; I++)
+			{
+				Out.Add(FVulHexAddr(Seq[Q++ % Seq.Num()], Seq[R++ % Seq.Num()]));
+			}
+		}
+
+		return Out;
+	}
+
+	/**
+	 * TVulHexgrid::AdjacentTiles as it used to be: generating offsets then copying tiles via GetTile.
+	 */
+	TArray<FBenchGrid::FVulTile> LegacyAdjacentTiles(const FBenchGrid& Grid, const FVulHexAddr& To, const int MaxRange)
+	{
+		TArray<FBenchGrid::FVulTile> Out;
+
+		for (const auto& Addr : LegacyGenerateGrid(MaxRange))
+		{
+			const auto Translated = To.Translate(Addr.Vector());
+
+			if (!(Translated == To) && Grid.IsValidAddr(Translated))
+			{
+				Out.Add(Grid.GetTile(Translated).GetValue());
+			}
+		}
+
+		return Out;
+	}
+}
+
+bool BenchmarkHexNeighbourhood::RunTest(const FString& Parameters)
+{
+	const FBenchGrid Grid(60, [](const FVulHexAddr&) { return 1; });
+	const TArray<FVulHexAddr> Centers = {{0, 0}, {20, -10}, {-45, 30}};
+	int64 Checksum = 0;
+
+	for (const auto MaxRange : {5, 20, 60})
+	{
+		const auto Legacy = VulTest::Benchmark(this, FString::Printf(TEXT("Legacy AdjacentTiles, range %d"), MaxRange), 50, [&]
+		{
+			for (const auto& Center : Centers)
+			{
+				Checksum += LegacyAdjacentTiles(Grid, Center, MaxRange).Num();
+			}
+		});
+
+		const auto Current = VulTest::Benchmark(this, FString::Printf(TEXT("AdjacentTiles, range %d"), MaxRange), 50, [&]
+		{
+			for (const auto& Center : Centers)
+			{
+				Checksum += Grid.AdjacentTiles(Center, MaxRange).Num();
+			}
+		});
+
+		VulTest::LogSpeedup(this, Legacy, Current);
+	}
+
+	// Visiting a neighbourhood without collecting it at all.
+	const auto Generated = VulTest::Benchmark(this, TEXT("GenerateGrid(60) loop"), 50, [&]
+	{
+		for (const auto& Addr : FVulHexAddr::GenerateGrid(60))
+		{
+			Checksum += Addr.Q;
+		}
+	});
+
+	const auto Spiral = VulTest::Benchmark(this, TEXT("FVulHexSpiral(60) loop"), 50, [&]
+	{
+		for (const auto Addr : FVulHexSpiral(FVulHexAddr::Origin(), 60))
+		{
+			Checksum += Addr.Q;
+		}
+	});
+
+	const auto Range = VulTest::Benchmark(this, TEXT("FVulHexRange(60) loop"), 50, [&]
+	{
+		for (const auto Addr : FVulHexRange(FVulHexAddr::Origin(), 60))
+		{
+			Checksum += Addr.Q;
+		}
+	});
+
+	VulTest::LogSpeedup(this, Generated, Spiral);
+	VulTest::LogSpeedup(this, Generated, Range);
+
+	const auto Addrs = FVulHexAddr::GenerateGrid(30);
+
+	const auto LegacyAdjacentTo = VulTest::Benchmark(this, TEXT("Adjacent().Contains"), 20, [&]
+	{
+		for (const auto& Addr : Addrs)
+		{
+			Checksum += Addr.Adjacent().Contains(FVulHexAddr(1, 0));
+		}
+	});
+
+	const auto AdjacentTo = VulTest::Benchmark(this, TEXT("AdjacentTo"), 20, [&]
+	{
+		for (const auto& Addr : Addrs)
+		{
+			Checksum += Addr.AdjacentTo(FVulHexAddr(1, 0));
+		}
+	});
+
+	VulTest::LogSpeedup(this, LegacyAdjacentTo, AdjacentTo);
+
+	TestTrue(TEXT("Workloads ran"), Checksum != 0);
+
+	return true;
+}
@@ -0,0 +1,90 @@
+﻿#include "Benchmark.h"
+#include "Hexgrid/VulHexUtil.h"
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	BenchmarkHexProjection,
+	"VulRuntime.Hexgrid.BenchmarkHexProjection",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter
+)
+
+bool BenchmarkHexProjection::RunTest(const FString& Parameters)
+{
+	const FVulWorldHexGridSettings Settings(50);
+	const FVulHexProjection Projection(Settings);
+	const auto Addrs = FVulHexAddr::GenerateGrid(60);
+	const auto Num = Addrs.Num();
+	double Checksum = 0;
+
+	TArray<FVulHexProjection::FReal> X, Y;
+	TArray<int32> Indices;
+	X.SetNum(Num * FVulHexProjection::VerticesPerTile);
+	Y.SetNum(Num * FVulHexProjection::VerticesPerTile);
+	Indices.SetNum(Num * FVulHexProjection::IndicesPerTile);
+
+	const auto ScalarProject = VulTest::Benchmark(this, TEXT("Project per tile"), 50, [&]
+	{
+		for (const auto& Addr : Addrs)
+		{
+			Checksum += VulRuntime::Hexgrid::Project(Addr, Settings).X;
+		}
+	});
+
+	const auto BatchProject = VulTest::Benchmark(this, TEXT("FVulHexProjection::Project"), 50, [&]
+	{
+		Projection.Project(Addrs, X, Y);
+		Checksum += X[Num - 1];
+	});
+
+	VulTest::LogSpeedup(this, ScalarProject, BatchProject);
+
+	const auto ScalarMesh = VulTest::Benchmark(this, TEXT("Triangles per tile"), 20, [&]
+	{
+		for (const auto& Addr : Addrs)
+		{
+			Checksum += VulRuntime::Hexgrid::Triangles(Addr, Settings, .9f)[0][0].X;
+		}
+	});
+
+	const auto BatchMesh = VulTest::Benchmark(this, TEXT("FVulHexProjection::TriangleMesh"), 20, [&]
+	{
+		Projection.TriangleMesh(Addrs, X, Y, Indices, .9f);
+		Checksum += X[Num - 1] + Indices[Num - 1];
+	});
+
+	VulTest::LogSpeedup(this, ScalarMesh, BatchMesh);
+
+	// Pick a point near every tile's center.
+	TArray<FVulHexProjection::FReal> WorldX, WorldY;
+	TArray<FVulHexAddr> Out;
+	WorldX.SetNum(Num);
+	WorldY.SetNum(Num);
+	Out.SetNum(Num);
+	Projection.Project(Addrs, WorldX, WorldY);
+
+	for (int32 I = 0; I < Num; ++I)
+	{
+		WorldX[I] += 3;
+		WorldY[I] -= 2;
+	}
+
+	const auto ScalarDeproject = VulTest::Benchmark(this, TEXT("Deproject per point"), 50, [&]
+	{
+		for (int32 I = 0; I < Num; ++I)
+		{
+			Checksum += VulRuntime::Hexgrid::Deproject(FVector(WorldX[I], WorldY[I], 0), Settings).Q;
+		}
+	});
+
+	const auto BatchDeproject = VulTest::Benchmark(this, TEXT("FVulHexProjection::Deproject"), 50, [&]
+	{
+		Projection.Deproject(WorldX, WorldY, Out);
+		Checksum += Out[Num - 1].Q;
+	});
+
+	VulTest::LogSpeedup(this, ScalarDeproject, BatchDeproject);
+
+	TestTrue(TEXT("Workloads ran"), Checksum != 0);
+
+	return true;
+}
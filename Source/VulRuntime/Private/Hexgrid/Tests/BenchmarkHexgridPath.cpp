@@ -0,0 +1,95 @@
+﻿#include "Benchmark.h"
+#include "Hexgrid/VulHexgrid.h"
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	BenchmarkHexgridPath,
+	"VulRuntime.Hexgrid.BenchmarkHexgridPath",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter
+)
+
+namespace
+{
+	typedef TVulHexgrid<int> FBenchGrid;
+
+	/**
+	 * Tile data is its movement cost, or 0 if impassable.
+	 */
+	TOptional<int> TileCost(const FBenchGrid::FVulTile& From, const FBenchGrid::FVulTile& To, const FBenchGrid* Grid)
+	{
+		if (To.Data == 0)
+		{
+			return {};
+		}
+
+		return To.Data;
+	}
+}
+
+bool BenchmarkHexgridPath::RunTest(const FString& Parameters)
+{
+	// 2107 tiles, with scattered obstacles.
+	FRandomStream Rng(123);
+	const FBenchGrid Grid(26, [&Rng](const FVulHexAddr&) { return Rng.RandHelper(8) == 0 ? 0 : Rng.RandRange(1, 3); });
+	const auto Addrs = Grid.GetTileAddrs();
+
+	TArray<TPair<FVulHexAddr, FVulHexAddr>> Queries;
+
+	for (int I = 0; I < 50; ++I)
+	{
+		Queries.Add({Addrs[Rng.RandHelper(Addrs.Num())], Addrs[Rng.RandHelper(Addrs.Num())]});
+	}
+
+	const FBenchGrid::TVulQueryOptions Opts(&TileCost);
+	const auto Lambda = [](const FBenchGrid::FVulTile& From, const FBenchGrid::FVulTile& To, const FBenchGrid* Grid) -> TOptional<int>
+	{
+		return TileCost(From, To, Grid);
+	};
+
+	FBenchGrid::FSearchScratch Scratch;
+	int64 Checksum = 0;
+
+	const auto Path = VulTest::Benchmark(this, TEXT("Path (TFunction)"), 20, [&]
+	{
+		for (const auto& Query : Queries)
+		{
+			Checksum += Grid.Path(Query.Key, Query.Value, Opts, Scratch).Cost;
+		}
+	});
+
+	const auto PathWith = VulTest::Benchmark(this, TEXT("PathWith (lambda)"), 20, [&]
+	{
+		for (const auto& Query : Queries)
+		{
+			Checksum += Grid.PathWith(Query.Key, Query.Value, Lambda, Scratch).Cost;
+		}
+	});
+
+	VulTest::LogSpeedup(this, Path, PathWith);
+
+	FBenchGrid::FReachable Reached;
+
+	const auto Reachable = VulTest::Benchmark(this, TEXT("Reachable (TFunction)"), 20, [&]
+	{
+		for (int I = 0; I < 10; ++I)
+		{
+			Grid.Reachable(Queries[I].Key, {}, Opts, Reached);
+			Checksum += Reached.Num();
+		}
+	});
+
+	const auto ReachableWith = VulTest::Benchmark(this, TEXT("ReachableWith (lambda)"), 20, [&]
+	{
+		for (int I = 0; I < 10; ++I)
+		{
+			Grid.ReachableWith(Queries[I].Key, {}, Lambda, Reached);
+			Checksum += Reached.Num();
+		}
+	});
+
+	VulTest::LogSpeedup(this, Reachable, ReachableWith);
+
+	TestTrue(TEXT("Workloads ran"), Checksum != 0);
+
+	return true;
+}
@@ -0,0 +1,70 @@
+﻿#include "Benchmark.h"
+#include "Hexgrid/VulHexOccupancy.h"
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	BenchmarkOccupancy,
+	"VulRuntime.Hexgrid.BenchmarkOccupancy",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter
+)
+
+bool BenchmarkOccupancy::RunTest(const FString& Parameters)
+{
+	FRandomStream Rng(789);
+	TArray<FVulHexAddr> Units;
+	TVulHexOccupancy<int32> Index;
+
+	for (int32 Unit = 0; Unit < 2000; ++Unit)
+	{
+		Units.Add(FVulHexAddr(Rng.RandRange(-40, 40), Rng.RandRange(-40, 40)));
+		Index.Add(Unit, Units.Last());
+	}
+
+	TArray<FVulHexAddr> Queries;
+
+	for (int32 Query = 0; Query < 200; ++Query)
+	{
+		Queries.Add(FVulHexAddr(Rng.RandRange(-40, 40), Rng.RandRange(-40, 40)));
+	}
+
+	int64 Checksum = 0;
+
+	for (const auto Range : {0, 2, 5})
+	{
+		const auto Scan = VulTest::Benchmark(this, FString::Printf(TEXT("Scan units, range %d"), Range), 20, [&]
+		{
+			for (const auto& Center : Queries)
+			{
+				for (int32 Unit = 0; Unit < Units.Num(); ++Unit)
+				{
+					if (Units[Unit].Distance(Center) <= Range)
+					{
+						Checksum += Unit;
+					}
+				}
+			}
+		});
+
+		const auto Indexed = VulTest::Benchmark(this, FString::Printf(TEXT("TVulHexOccupancy, range %d"), Range), 20, [&]
+		{
+			for (const auto& Center : Queries)
+			{
+				Index.ForEachInRange(Center, Range, [&](const int32 Unit, const FVulHexAddr&) { Checksum += Unit; });
+			}
+		});
+
+		VulTest::LogSpeedup(this, Scan, Indexed);
+	}
+
+	VulTest::Benchmark(this, TEXT("TVulHexOccupancy move all units"), 20, [&]
+	{
+		for (int32 Unit = 0; Unit < Units.Num(); ++Unit)
+		{
+			Index.Move(Unit, FVulHexAddr(Units[Unit].Q + Rng.RandRange(-1, 1), Units[Unit].R));
+		}
+	});
+
+	TestTrue(TEXT("Workloads ran"), Checksum != 0);
+
+	return true;
+}
@@ -1,5 +1,6 @@
 ﻿#include "TestCase.h"
 #include "Hexgrid/VulHexAddr.h"
+#include "Hexgrid/VulHexNeighbourhood.h"
 #include "Misc/AutomationTest.h"
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(
@@ -26,5 +27,95 @@ bool TestAddr::RunTest(const FString& Parameters)
 		Ddt.Run("0,0 -> 0,-1", {.From={0, 0}, .To = {0, -1}, .Expected=5});
 	}
 
+	VulTest::Case(this, "Key", [](VulTest::TC TC)
+	{
+		TSet<uint64> Packed;
+		TSet<uint32> Hashes;
+		const auto Addrs = FVulHexAddr::GenerateGrid(20);
+
+		for (const auto& Addr : Addrs)
+		{
+			const FVulHexKey Key(Addr);
+
+			TC.Equal(Key.ToAddr(), Addr, FString::Printf(TEXT("%s round trip"), *Addr.ToString()));
+			TC.Equal(Key == FVulHexKey(Addr), true, FString::Printf(TEXT("%s equal"), *Addr.ToString()));
+
+			Packed.Add(Key.GetPacked());
+			Hashes.Add(GetTypeHash(Key));
+		}
+
+		TC.Equal(Packed.Num(), Addrs.Num(), "Packed keys are unique");
+		TC.Equal(Hashes.Num(), Addrs.Num(), "No hash collisions near the origin");
+		TC.Equal(GetTypeHash(FVulHexAddr(3, -5)), GetTypeHash(FVulHexKey(FVulHexAddr(3, -5))), "Addr and key hash the same");
+		TC.Equal(FVulHexKey(FVulHexAddr(1, 0)) != FVulHexKey(FVulHexAddr(0, 1)), true, "Not equal");
+	});
+
+	VulTest::Case(this, "Neighbourhood", [](VulTest::TC TC)
+	{
+		const FVulHexAddr Center(3, -5);
+
+		const auto Collect = [](const auto& Iterable)
+		{
+			TArray<FVulHexAddr> Out;
+
+			for (const auto Addr : Iterable)
+			{
+				Out.Add(Addr);
+			}
+
+			return Out;
+		};
+
+		const auto Translate = [](const TArray<FVulHexAddr>& Addrs, const FVulHexAddr& By)
+		{
+			TArray<FVulHexAddr> Out;
+
+			for (const auto& Addr : Addrs)
+			{
+				Out.Add(Addr.Translate(By.Vector()));
+			}
+
+			return Out;
+		};
+
+		TArray<FVulHexAddr> Ring2;
+		FVulHexAddr::GenerateRing(2, Ring2);
+
+		TC.Equal(Ring2, TArray<FVulHexAddr>{
+			{0, 2}, {-1, 2}, {-2, 2}, {-2, 1}, {-2, 0}, {-1, -1},
+			{0, -2}, {1, -2}, {2, -2}, {2, -1}, {2, 0}, {1, 1},
+		}, "Ring order");
+
+		for (int Radius = 0; Radius <= 6; ++Radius)
+		{
+			const auto Msg = FString::Printf(TEXT("Radius %d"), Radius);
+
+			TArray<FVulHexAddr> Ring;
+			FVulHexAddr::GenerateRing(Radius, Ring);
+			const auto Grid = FVulHexAddr::GenerateGrid(Radius);
+
+			TC.Equal(Collect(FVulHexRing(Center, Radius)), Translate(Ring, Center), Msg + TEXT(" ring"));
+			TC.Equal(FVulHexRing(Center, Radius).Num(), Ring.Num(), Msg + TEXT(" ring num"));
+			TC.Equal(Collect(FVulHexSpiral(Center, Radius)), Translate(Grid, Center), Msg + TEXT(" spiral"));
+			TC.Equal(FVulHexSpiral(Center, Radius).Num(), Grid.Num(), Msg + TEXT(" spiral num"));
+
+			auto Range = Collect(FVulHexRange(Center, Radius));
+			auto Expected = Translate(Grid, Center);
+			const auto ByQR = [](const FVulHexAddr& A, const FVulHexAddr& B) { return A.Q != B.Q ? A.Q < B.Q : A.R < B.R; };
+			Range.Sort(ByQR);
+			Expected.Sort(ByQR);
+
+			TC.Equal(Range, Expected, Msg + TEXT(" range"));
+			TC.Equal(FVulHexRange(Center, Radius).Num(), Expected.Num(), Msg + TEXT(" range num"));
+		}
+
+		for (const auto& Addr : FVulHexAddr::GenerateGrid(3))
+		{
+			TC.Equal(Center.AdjacentTo(Center.Translate(Addr.Vector())), Addr.Distance(FVulHexAddr::Origin()) == 1, Addr.ToString());
+		}
+
+		TC.Equal(Center.Adjacent(), Translate(TArray<FVulHexAddr>{{1, 0}, {0, 1}, {-1, 1}, {-1, 0}, {0, -1}, {1, -1}}, Center), "Adjacent");
+	});
+
 	return !HasAnyErrors();
 }
@@ -0,0 +1,198 @@
+﻿#include "TestCase.h"
+#include "Hexgrid/VulChunkedHexgrid.h"
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	TestChunkedHexgrid,
+	"VulRuntime.Hexgrid.TestChunkedHexgrid",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter
+)
+
+using namespace VulTest;
+
+namespace
+{
+	typedef TVulChunkedHexgrid<int> FChunkedGrid;
+
+	/**
+	 * A deterministic scattering of obstacles (0), with other tiles costing 1-3 to enter.
+	 */
+	int GenerateTile(const FVulHexAddr& Addr)
+	{
+		const auto Hash = GetTypeHash(Addr);
+		return Hash % 7 == 0 ? 0 : 1 + Hash % 3;
+	}
+}
+
+bool TestChunkedHexgrid::RunTest(const FString& Parameters)
+{
+	Case(this, "Tiles", [](TC TC)
+	{
+		const FChunkedGrid Grid(8, &GenerateTile, 4);
+
+		TC.Equal(Grid.ChunkOf({0, 0}), FIntPoint(0, 0), "origin chunk");
+		TC.Equal(Grid.ChunkOf({7, 7}), FIntPoint(0, 0), "last tile in chunk");
+		TC.Equal(Grid.ChunkOf({8, -1}), FIntPoint(1, -1), "positive and negative chunk");
+		TC.Equal(Grid.ChunkOf({-8, -9}), FIntPoint(-1, -2), "negative chunks");
+		TC.Equal(Grid.ResidentChunkCount(), 0, "no chunks before access");
+
+		for (const auto Addr : FVulHexRange({-20, 30}, 5))
+		{
+			TC.Equal(Grid.TileAt(Addr).Addr, Addr, "tile address");
+			TC.Equal(Grid.TileAt(Addr).Data, GenerateTile(Addr), "tile data");
+		}
+
+		for (auto Q = 0; Q < 10; ++Q)
+		{
+			Grid.TileAt({Q * 8, 0});
+			TC.Equal(Grid.ResidentChunkCount() <= 4, true, "within budget");
+		}
+
+		TC.Equal(Grid.IsResident(FIntPoint(9, 0)), true, "most recent chunk is resident");
+		TC.Equal(Grid.IsResident(FIntPoint(0, 0)), false, "least recent chunk is evicted");
+		TC.Equal(Grid.TileAt({1, 1}).Data, GenerateTile({1, 1}), "evicted chunk is regenerated");
+
+		// Range 1 of a chunk corner touches all but the diagonally opposite chunk.
+		Grid.Preload({96, 96}, 1);
+		TC.Equal(Grid.IsResident(FIntPoint(12, 12)), true, "preloaded chunk");
+		TC.Equal(Grid.IsResident(FIntPoint(11, 12)), true, "preloaded neighbouring chunk");
+		TC.Equal(Grid.IsResident(FIntPoint(12, 11)), true, "preloaded other neighbouring chunk");
+		TC.Equal(Grid.IsResident(FIntPoint(11, 11)), false, "chunk out of range");
+	});
+
+	Case(this, "Modified chunks", [](TC TC)
+	{
+		FChunkedGrid Grid(4, &GenerateTile, 2);
+
+		Grid.SetTileData({1, 1}, 100);
+
+		for (auto Q = 1; Q < 5; ++Q)
+		{
+			Grid.TileAt({Q * 4, 0});
+		}
+
+		TC.Equal(Grid.IsResident(FIntPoint(0, 0)), true, "modified chunk is kept without a pager");
+		TC.Equal(Grid.ResidentChunkCount(), 2, "kept chunk counts towards budget");
+		TC.Equal(Grid.Flush(), false, "cannot flush without a pager");
+
+		FChunkedGrid Single(4, &GenerateTile, 1);
+		Single.SetTileData({0, 0}, 100);
+		TC.Equal(Single.TileAt({100, 0}).Data, GenerateTile({100, 0}), "loaded chunk is kept when others cannot be evicted");
+		TC.Equal(Single.ResidentChunkCount(), 2, "over budget whilst chunks cannot be evicted");
+		TC.Equal(Single.TileAt({0, 0}).Data, 100, "unevictable chunk is kept");
+
+		TMap<FIntPoint, TArray<int>> Paged;
+		int Loads = 0;
+
+		Grid.SetPager({
+			[&Paged](const FIntPoint& Chunk, const TArray<int>& Data)
+			{
+				Paged.Add(Chunk, Data);
+				return true;
+			},
+			[&Paged, &Loads](const FIntPoint& Chunk, TArray<int>& OutData)
+			{
+				++Loads;
+
+				if (const auto Found = Paged.Find(Chunk))
+				{
+					OutData = *Found;
+					return true;
+				}
+
+				return false;
+			},
+		});
+
+		Grid.TileAt({20, 0});
+		TC.Equal(Grid.IsResident(FIntPoint(0, 0)), false, "modified chunk is paged out");
+		TC.Equal(Paged.Contains(FIntPoint(0, 0)), true, "modified chunk was saved");
+		TC.Equal(Paged.Num(), 1, "unmodified chunks are not saved");
+
+		TC.Equal(Grid.TileAt({1, 1}).Data, 100, "modified tile is restored");
+		TC.Equal(Grid.TileAt({2, 1}).Data, GenerateTile({2, 1}), "other tiles are restored");
+
+		Grid.ModifyTileData({-3, 2})->Data = 200;
+		TC.Equal(Grid.Flush(), true, "flush");
+		TC.Equal(Paged[Grid.ChunkOf({-3, 2})][1 + 2 * 4], 200, "flushed tile");
+
+		const auto LoadsBefore = Loads;
+		Grid.TileAt({-100, -100});
+		TC.Equal(Loads, LoadsBefore + 1, "loading consults the pager");
+	});
+
+	Case(this, "Queries match a dense grid", [](TC TC)
+	{
+		constexpr int Radius = 12;
+
+		const TVulHexgrid<int> Dense(Radius, &GenerateTile);
+		const FChunkedGrid Chunked(5, &GenerateTile, 3);
+
+		const TVulHexgrid<int>::TVulQueryOptions DenseOpts([](const auto&, const auto& To, const auto*) -> TOptional<int>
+		{
+			return To.Data == 0 ? TOptional<int>() : To.Data;
+		});
+
+		// Outside of the dense grid's radius is impassable, so both grids search the same tiles.
+		const FChunkedGrid::TVulQueryOptions ChunkedOpts([](const auto&, const auto& To, const auto*) -> TOptional<int>
+		{
+			return To.Data == 0 || To.Addr.Distance(FVulHexAddr::Origin()) > Radius ? TOptional<int>() : To.Data;
+		});
+
+		const TArray<FVulHexAddr> Ends = {{-12, 0}, {12, -12}, {0, 12}, {5, -3}, {-7, 9}, {3, 3}, {-2, -10}};
+
+		for (const auto& From : Ends)
+		{
+			for (const auto& To : Ends)
+			{
+				const auto Expected = Dense.Path(From, To, DenseOpts);
+				const auto Actual = Chunked.Path(From, To, ChunkedOpts);
+				const auto Label = From.ToString() + " to " + To.ToString();
+
+				TC.Equal(Actual.Complete, Expected.Complete, Label + " complete");
+				TC.Equal(Actual.Cost, Expected.Cost, Label + " cost");
+				TC.Equal(Actual.Tiles.Num() > 0, Expected.Tiles.Num() > 0, Label + " has tiles");
+				TC.Equal(Chunked.ResidentChunkCount() <= 3, true, Label + " evicts after query");
+
+				const auto IsClear = [](const auto& Tile) { return Tile.Data != 0; };
+				TC.Equal(Chunked.Trace(From, To, IsClear).Tiles, Dense.Trace(From, To, IsClear).Tiles, Label + " trace");
+			}
+		}
+
+		TArray<FVulHexAddr> DenseAdjacent, ChunkedAdjacent;
+
+		for (const auto& Tile : Dense.AdjacentTiles({4, -2}, 3, true))
+		{
+			DenseAdjacent.Add(Tile.Addr);
+		}
+
+		for (const auto& Tile : Chunked.AdjacentTiles({4, -2}, 3, true))
+		{
+			ChunkedAdjacent.Add(Tile.Addr);
+			TC.Equal(Tile.Data, GenerateTile(Tile.Addr), "adjacent tile data");
+		}
+
+		TC.Equal(ChunkedAdjacent, DenseAdjacent, "adjacent tiles across chunks");
+	});
+
+	Case(this, "Unreachable", [](TC TC)
+	{
+		// Walls off the origin.
+		const FChunkedGrid Grid(16, [](const FVulHexAddr& Addr) { return Addr.Distance(FVulHexAddr::Origin()) == 3 ? 0 : 1; });
+
+		FChunkedGrid::TVulQueryOptions Opts([](const auto&, const auto& To, const auto*) -> TOptional<int>
+		{
+			return To.Data == 0 ? TOptional<int>() : 1;
+		});
+
+		Opts.MaxVisited = 2000;
+
+		const auto Result = Grid.Path({50, 0}, FVulHexAddr::Origin(), Opts);
+
+		TC.Equal(Result.Complete, false, "not complete");
+		TC.Equal(Result.Tiles.Last().Addr.Distance(FVulHexAddr::Origin()), 4, "gets as close as possible");
+		TC.Equal(Grid.ResidentChunkCount() <= 64, true, "evicts after query");
+	});
+
+	return true;
+}
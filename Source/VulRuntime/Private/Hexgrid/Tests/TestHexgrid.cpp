@@ -51,6 +51,30 @@ bool TestHexgrid::RunTest(const FString& Parameters)
 		Ddt.Run("Edge tile, 2 adj", {.To = {0, 3}, .MaxRange = 2, .GridSize = 3, .ExpectedCount = 8});
 	}
 
+	VulTest::Case(this, "Irregular grid", [](TC TC)
+	{
+		TestGrid Grid;
+
+		Grid.AddTile({0, 0}, TEXT("origin"));
+		Grid.AddTile({5, -2}, TEXT("far"));
+		Grid.AddTile({-3, 4}, TEXT("other far"));
+		Grid.AddTile({1, 0}, TEXT("adjacent"));
+
+		TC.Equal(Grid.TileCount(), 4, "TileCount");
+		TC.Equal(Grid.IsValidAddr({5, -2}), true, "Added tile is valid");
+		TC.Equal(Grid.IsValidAddr({4, -2}), false, "Tile within layout but not added is invalid");
+		TC.Equal(Grid.GetTile({-3, 4})->Data, FString(TEXT("other far")), "Tile data survives relayout");
+		TC.Equal(Grid.AdjacentTiles({0, 0}).Num(), 1, "Adjacent tiles");
+
+		Grid.ModifyTileData({5, -2})->Data = TEXT("modified");
+		TC.Equal(Grid.GetTile({5, -2})->Data, FString(TEXT("modified")), "ModifyTileData");
+
+		Grid.RemoveTile({5, -2});
+		TC.Equal(Grid.TileCount(), 3, "TileCount after removal");
+		TC.Equal(Grid.GetTile({5, -2}).IsSet(), false, "Removed tile is not set");
+		TC.Equal(Grid.GetTileAddrs().Contains(FVulHexAddr(5, -2)), false, "Removed tile is not listed");
+	});
+
 	// Direct path cases; all reach goal.
 	TestPath(this, 3, FVulHexAddr(-2, 1), FVulHexAddr(3, -3), 5);
 	TestPath(this, 3, FVulHexAddr(-3, 0), FVulHexAddr(3, 0), 6);
@@ -94,6 +118,55 @@ bool TestHexgrid::RunTest(const FString& Parameters)
 		5
 	);
 
+	VulTest::Case(this, "Path with reused scratch", [](TC TC)
+	{
+		const auto Grid = MakeGrid(4);
+		const TArray<FVulHexAddr> Impassable = {{1, -1}, {0, -1}, {1, 0}, {-2, 3}};
+
+		TestGrid::TVulQueryOptions Opts;
+		Opts.CostFn = [Impassable](const TestGrid::FVulTile& From, const TestGrid::FVulTile& To, const TestGrid* Grid) -> TOptional<int>
+		{
+			if (Impassable.Contains(To.Addr))
+			{
+				return {};
+			}
+
+			return 1;
+		};
+
+		TestGrid::FSearchScratch Scratch;
+		const TArray<TPair<FVulHexAddr, FVulHexAddr>> Queries = {
+			{{0, 0}, {2, -2}},
+			{{-4, 0}, {4, 0}},
+			{{0, 0}, {2, -2}},
+			{{-2, 2}, {-2, 3}},
+			{{3, -3}, {-1, 4}},
+		};
+
+		for (const auto& Query : Queries)
+		{
+			const auto Expected = Grid.Path(Query.Key, Query.Value, Opts);
+			const auto Actual = Grid.Path(Query.Key, Query.Value, Opts, Scratch);
+
+			TC.Equal(Actual.Complete, Expected.Complete, "Complete");
+			TC.Equal(Actual.Cost, Expected.Cost, "Cost");
+			TC.Equal(Actual.Addrs(), Expected.Addrs(), "Addrs");
+
+			const auto Inlined = Grid.PathWith(Query.Key, Query.Value, [&Opts](const TestGrid::FVulTile& From, const TestGrid::FVulTile& To, const TestGrid* Grid)
+			{
+				return Opts.CostFn(From, To, Grid);
+			}, Scratch);
+
+			TC.Equal(Inlined.Complete, Expected.Complete, "Inlined complete");
+			TC.Equal(Inlined.Cost, Expected.Cost, "Inlined cost");
+			TC.Equal(Inlined.Addrs(), Expected.Addrs(), "Inlined addrs");
+
+			TestGrid::FReachable Reached;
+			Grid.ReachableWith(Query.Key, 3, Opts.CostFn, Reached);
+			TC.Equal(Reached.GetReachedAddrs(), Grid.Reachable(Query.Key, 3, Opts).GetReachedAddrs(), "ReachableWith");
+		}
+	});
+
 	{
 		struct Data { int GridSize; FVulHexAddr From; FVulHexAddr To; TArray<FVulHexAddr> ExpectedTiles; bool ExpectedComplete; };
 		auto Ddt = DDT<Data>(this, "Hexgrid Trace", [](const TestCase& TestCase, const Data& Data)
@@ -179,6 +252,63 @@ bool TestHexgrid::RunTest(const FString& Parameters)
 		});
 	}
 
+	VulTest::Case(this, "Hex line", [](TC TC)
+	{
+		TC.Equal(FVulHexLine({0, 0}, {0, 0}).ToArray(), TArray<FVulHexAddr>{{0, 0}}, "Single tile");
+		TC.Equal(FVulHexLine({0, 0}, {3, 0}).ToArray(), TArray<FVulHexAddr>{{0, 0}, {1, 0}, {2, 0}, {3, 0}}, "Straight");
+		TC.Equal(FVulHexLine({0, 0}, {2, -3}).ToArray(), TArray<FVulHexAddr>{{0, 0}, {1, -1}, {1, -2}, {2, -3}}, "Non-straight");
+		TC.Equal(FVulHexLine({-3, 1}, {4, -2}).Num(), 7, "Num is distance");
+
+		// Samples exactly on the boundary between two tiles resolve the same way every time.
+		TC.Equal(FVulHexLine({0, -1}, {1, 0}).At(1), FVulHexAddr(0, 0), "Boundary");
+		TC.Equal(FVulHexLine({-12, -12}, {-9, -9}).At(5), FVulHexAddr(-10, -9), "Boundary, far from origin");
+	});
+
+	VulTest::Case(this, "Field of view", [](TC TC)
+	{
+		const auto Grid = MakeGrid(5);
+		const TArray<FVulHexAddr> Obstacles = {{1, -1}, {0, 2}, {-2, 1}, {3, 0}, {2, 2}};
+		const auto Check = [Obstacles](const TestGrid::FVulTile& Tile) { return !Obstacles.Contains(Tile.Addr); };
+
+		const auto Visibility = Grid.PrecomputeVisibility(3, Check);
+
+		for (const auto& Origin : TArray<FVulHexAddr>{{0, 0}, {-1, 2}, {4, -4}})
+		{
+			const auto Visible = Grid.FieldOfView(Origin, 4, Check);
+			TArray<FVulHexAddr> Expected;
+			int ExpectedPrecomputed = 0;
+
+			for (const auto& Addr : Grid.GetTileAddrs())
+			{
+				const auto Complete = Grid.Trace(Origin, Addr, Check).Complete;
+
+				if (Origin.Distance(Addr) <= 4 && Complete)
+				{
+					Expected.Add(Addr);
+				}
+
+				ExpectedPrecomputed += Origin.Distance(Addr) <= 3 && Complete;
+
+				TC.Equal(
+					Visibility.IsVisible(Origin, Addr),
+					Origin.Distance(Addr) <= 3 && Complete,
+					FString::Printf(TEXT("Precomputed %s -> %s"), *Origin.ToString(), *Addr.ToString())
+				);
+			}
+
+			Expected.Sort([](const FVulHexAddr& A, const FVulHexAddr& B) { return A.ToString() < B.ToString(); });
+			auto Actual = Visible;
+			Actual.Sort([](const FVulHexAddr& A, const FVulHexAddr& B) { return A.ToString() < B.ToString(); });
+
+			TC.Equal(Actual, Expected, FString::Printf(TEXT("Field of view from %s"), *Origin.ToString()));
+			TC.Equal(Visible.Contains(Origin), true, "Origin is visible");
+			TC.Equal(Visibility.GetVisible(Origin).Num(), ExpectedPrecomputed, "Visible from precomputed");
+		}
+
+		TC.Equal(Grid.FieldOfView(FVulHexAddr(10, 10), 4, Check).Num(), 0, "Invalid origin");
+		TC.Equal(Visibility.IsVisible(FVulHexAddr(0, 0), FVulHexAddr(4, 0)), false, "Out of precomputed range");
+	});
+
 
 	{
 		struct Data
@@ -314,6 +444,713 @@ bool TestHexgrid::RunTest(const FString& Parameters)
 		});
 	}
 
+	VulTest::Case(this, "Reachable", [](TC TC)
+	{
+		const auto Grid = MakeGrid(4);
+		const TArray<FVulHexAddr> Impassable = {{1, -1}, {0, -1}, {1, 0}, {-3, 3}, {-3, 4}, {-4, 3}};
+
+		// Weighted, so the cheapest routes are not simply the shortest.
+		TestGrid::TVulQueryOptions Opts;
+		Opts.CostFn = [Impassable](const TestGrid::FVulTile& From, const TestGrid::FVulTile& To, const TestGrid* Grid) -> TOptional<int>
+		{
+			if (Impassable.Contains(To.Addr))
+			{
+				return {};
+			}
+
+			return 1 + FMath::Abs(To.Addr.Q) % 3;
+		};
+
+		TestGrid::FReachable Reached;
+
+		for (const auto& Origin : TArray<FVulHexAddr>{{0, 0}, {3, -1}, {0, 0}})
+		{
+			Grid.Reachable(Origin, {}, Opts, Reached);
+
+			TC.Equal(Reached.GetOrigin(), Origin, "Origin");
+			TC.Equal(Reached.IsReachable(Origin), false, "Origin not reachable");
+			TC.Equal(Reached.IsReachable(FVulHexAddr(-4, 4)), false, "Enclosed tile not reachable");
+			TC.Equal(Reached.Num(), Grid.TileCount() - Impassable.Num() - 2, "Reached count");
+
+			int Previous = 0;
+
+			for (const auto& Addr : Reached.GetReachedAddrs())
+			{
+				const auto Cost = Reached.GetCost(Addr).GetValue();
+				const auto Expected = Grid.Path(Origin, Addr, Opts);
+				const auto Path = Grid.ReachablePath(Reached, Addr);
+
+				TC.Equal(Cost >= Previous, true, FString::Printf(TEXT("%s in cost order"), *Addr.ToString()));
+				TC.Equal(Cost, Expected.Cost, FString::Printf(TEXT("%s cost matches Path"), *Addr.ToString()));
+				TC.Equal(Path.Complete, true, FString::Printf(TEXT("%s path complete"), *Addr.ToString()));
+				TC.Equal(Path.Cost, Cost, FString::Printf(TEXT("%s path cost"), *Addr.ToString()));
+				TC.Equal(Path.Addrs().Last(), Addr, FString::Printf(TEXT("%s path ends at tile"), *Addr.ToString()));
+				TC.Equal(Path.Tiles[0].Addr.Distance(Origin), 1, FString::Printf(TEXT("%s path starts adjacent"), *Addr.ToString()));
+
+				Previous = Cost;
+			}
+		}
+
+		Grid.Reachable(FVulHexAddr(0, 0), 2, Opts, Reached);
+
+		TC.Equal(Reached.GetCost(FVulHexAddr(0, 1)), TOptional<int>(1), "Within max cost");
+		TC.Equal(Reached.IsReachable(FVulHexAddr(-1, 0)), true, "At max cost");
+		TC.Equal(Reached.IsReachable(FVulHexAddr(0, 3)), false, "Beyond max cost");
+		TC.Equal(Reached.GetPath(FVulHexAddr(0, 3)).Num(), 0, "No path beyond max cost");
+		TC.Equal(Grid.ReachablePath(Reached, FVulHexAddr(0, 3)).Complete, false, "Incomplete path beyond max cost");
+
+		TC.Equal(Grid.Reachable(FVulHexAddr(10, 0)).Num(), 0, "Invalid origin");
+	});
+
+	VulTest::Case(this, "Distance field & influence map", [](TC TC)
+	{
+		const auto Grid = MakeGrid(4);
+		const TArray<FVulHexAddr> Impassable = {{1, -1}, {0, -1}, {1, 0}, {-2, 3}};
+
+		TestGrid::TVulQueryOptions Opts;
+		Opts.CostFn = [Impassable](const TestGrid::FVulTile& From, const TestGrid::FVulTile& To, const TestGrid* Grid) -> TOptional<int>
+		{
+			if (Impassable.Contains(To.Addr))
+			{
+				return {};
+			}
+
+			return 1 + FMath::Abs(To.Addr.R) % 2;
+		};
+
+		const TArray<FVulHexAddr> Sources = {{0, 0}, {3, -3}, {-4, 2}, {10, 10}};
+		TArray<TestGrid::FReachable> PerSource;
+
+		for (const auto& Source : Sources)
+		{
+			PerSource.Add(Grid.Reachable(Source, {}, Opts));
+		}
+
+		TArray<int> Costs;
+		TArray<int32> Nearest;
+		Grid.DistanceField(Sources, Costs, {}, Opts, &Nearest);
+
+		TC.Equal(Costs.Num(), Grid.GetLayout().Num(), "One cost per layout index");
+
+		for (const auto& Addr : Grid.GetTileAddrs())
+		{
+			const auto Index = Grid.TileIndex(Addr);
+			auto Expected = TestGrid::UnreachedCost;
+
+			for (int32 I = 0; I < Sources.Num(); ++I)
+			{
+				if (Sources[I] == Addr)
+				{
+					Expected = 0;
+				} else if (PerSource[I].IsReachable(Addr))
+				{
+					Expected = FMath::Min(Expected, PerSource[I].GetCost(Addr).GetValue());
+				}
+			}
+
+			TC.Equal(Costs[Index], Expected, FString::Printf(TEXT("%s cost to nearest source"), *Addr.ToString()));
+
+			if (Expected != TestGrid::UnreachedCost)
+			{
+				const auto Source = Sources[Nearest[Index]];
+				const auto SourceCost = Source == Addr ? 0 : PerSource[Nearest[Index]].GetCost(Addr).Get(-1);
+				TC.Equal(SourceCost, Expected, FString::Printf(TEXT("%s nearest source"), *Addr.ToString()));
+			} else
+			{
+				TC.Equal(Nearest[Index], INDEX_NONE, FString::Printf(TEXT("%s no nearest source"), *Addr.ToString()));
+			}
+		}
+
+		Grid.DistanceField(Sources, Costs, 2, Opts);
+		TC.Equal(Costs[Grid.TileIndex(FVulHexAddr(-1, 1))], 2, "Within max cost");
+		TC.Equal(Costs[Grid.TileIndex(FVulHexAddr(2, 1))], TestGrid::UnreachedCost, "Beyond max cost");
+
+		const TArray<TestGrid::FInfluenceSource> Influencers = {{{0, 0}, 4}, {{3, -3}, 2}, {{-4, 2}, 0}};
+		TArray<int> Influence, SummedInfluence;
+		Grid.InfluenceMap(Influencers, Influence, Opts);
+		Grid.InfluenceMap(Influencers, SummedInfluence, Opts, TestGrid::EInfluenceBlend::Sum);
+
+		for (const auto& Addr : Grid.GetTileAddrs())
+		{
+			int Expected = 0;
+			int ExpectedSum = 0;
+
+			for (int32 I = 0; I < Influencers.Num(); ++I)
+			{
+				const auto Cost = Influencers[I].Addr == Addr ? TOptional<int>(0) : PerSource[I].GetCost(Addr);
+
+				if (Cost.IsSet())
+				{
+					Expected = FMath::Max(Expected, Influencers[I].Strength - Cost.GetValue());
+					ExpectedSum += FMath::Max(0, Influencers[I].Strength - Cost.GetValue());
+				}
+			}
+
+			TC.Equal(Influence[Grid.TileIndex(Addr)], Expected, FString::Printf(TEXT("%s influence"), *Addr.ToString()));
+			TC.Equal(SummedInfluence[Grid.TileIndex(Addr)], ExpectedSum, FString::Printf(TEXT("%s summed influence"), *Addr.ToString()));
+		}
+	});
+
+	VulTest::Case(this, "Score tiles", [](TC TC)
+	{
+		const auto Grid = MakeGrid(4);
+
+		// Plenty of ties, and some exclusions.
+		const auto ScoreFn = [](const TestGrid::FVulTile& Tile) -> TOptional<float>
+		{
+			if (Tile.Addr.Q == 2)
+			{
+				return {};
+			}
+
+			return static_cast<float>(Tile.Addr.Distance(FVulHexAddr(1, -1)));
+		};
+
+		const auto Addrs = [](const TArray<TPair<TestGrid::FVulTile, float>>& Scored)
+		{
+			TArray<FVulHexAddr> Out;
+
+			for (const auto& Entry : Scored)
+			{
+				Out.Add(Entry.Key.Addr);
+			}
+
+			return Out;
+		};
+
+		for (const auto Ascending : {true, false})
+		{
+			const auto Expected = Grid.ScoreTiles(ScoreFn, Ascending);
+			const auto Msg = FString(Ascending ? TEXT("Ascending") : TEXT("Descending"));
+
+			TC.Equal(Expected.Num(), Grid.TileCount() - 7, Msg + TEXT(" excludes unset scores"));
+
+			bool Ordered = true;
+
+			for (int I = 1; I < Expected.Num(); ++I)
+			{
+				const auto& Prev = Expected[I - 1];
+				const auto& Next = Expected[I];
+
+				if (Prev.Value == Next.Value)
+				{
+					Ordered &= Prev.Key.Addr.Q < Next.Key.Addr.Q
+						|| (Prev.Key.Addr.Q == Next.Key.Addr.Q && Prev.Key.Addr.R < Next.Key.Addr.R);
+				} else
+				{
+					Ordered &= Ascending ? Prev.Value < Next.Value : Prev.Value > Next.Value;
+				}
+			}
+
+			TC.Equal(Ordered, true, Msg + TEXT(" ordered by score, then Q, then R"));
+			TC.Equal(Addrs(Grid.ScoreTilesParallel(ScoreFn, Ascending)), Addrs(Expected), Msg + TEXT(" parallel"));
+
+			for (const auto Limit : {0, 1, 5, 12, 1000})
+			{
+				auto ExpectedLimited = Addrs(Expected);
+				ExpectedLimited.SetNum(FMath::Min(Limit, ExpectedLimited.Num()));
+
+				TC.Equal(
+					Addrs(Grid.ScoreTilesParallel(ScoreFn, Ascending, Limit)),
+					ExpectedLimited,
+					FString::Printf(TEXT("%s parallel, limit %d"), *Msg, Limit)
+				);
+			}
+		}
+	});
+
+	VulTest::Case(this, "Path cache", [](TC TC)
+	{
+		auto Grid = MakeGrid(5);
+		const auto Addrs = Grid.GetTileAddrs();
+
+		// Tile data is its movement cost as a string length, or # for impassable.
+		for (const auto& Addr : Addrs)
+		{
+			Grid.SetTileData(Addr, TEXT("a"));
+		}
+
+		int CostFnCalls = 0;
+
+		TestGrid::TVulQueryOptions Uncached;
+		Uncached.CostFn = [&CostFnCalls](const TestGrid::FVulTile& From, const TestGrid::FVulTile& To, const TestGrid* Grid) -> TOptional<int>
+		{
+			++CostFnCalls;
+
+			if (To.Data == TEXT("#"))
+			{
+				return {};
+			}
+
+			return To.Data.Len();
+		};
+
+		auto Cached = Uncached;
+		Cached.CacheKey = FName("Test");
+
+		Grid.SetPathCacheCapacity(2);
+
+		const TArray<FVulHexAddr> Origins = {{0, 0}, {2, -1}, {-3, 1}};
+		const TArray<FString> Data = {TEXT("a"), TEXT("aa"), TEXT("aaa"), TEXT("#")};
+		FRandomStream Rng(123);
+
+		const auto CostsTo = [&Addrs](const TestGrid::FReachable& Reached)
+		{
+			TArray<int> Out;
+
+			for (const auto& Addr : Addrs)
+			{
+				Out.Add(Reached.GetCost(Addr).Get(-1));
+			}
+
+			return Out;
+		};
+
+		for (int Turn = 0; Turn < 20; ++Turn)
+		{
+			for (int Edit = 0; Edit < 3; ++Edit)
+			{
+				const auto& Addr = Addrs[Rng.RandHelper(Addrs.Num())];
+				const auto& NewData = Data[Rng.RandHelper(Data.Num())];
+
+				if (Edit == 0)
+				{
+					Grid.ModifyTileData(Addr)->Data = NewData;
+				} else
+				{
+					Grid.SetTileData(Addr, NewData);
+				}
+			}
+
+			for (const auto& Origin : Origins)
+			{
+				const auto Msg = FString::Printf(TEXT("Turn %d from %s"), Turn, *Origin.ToString());
+				const auto Expected = Grid.Reachable(Origin, {}, Uncached);
+				const auto To = Addrs[Rng.RandHelper(Addrs.Num())];
+
+				TC.Equal(CostsTo(Grid.Reachable(Origin, {}, Cached)), CostsTo(Expected), Msg + TEXT(" costs"));
+				TC.Equal(Grid.Paths(Origin, 3, Cached).Num(), Grid.Paths(Origin, 3, Uncached).Num(), Msg + TEXT(" max cost"));
+				TC.Equal(Grid.Path(Origin, To, Cached).Cost, Grid.Path(Origin, To, Uncached).Cost, Msg + TEXT(" path cost"));
+			}
+		}
+
+		Grid.RemoveTile(FVulHexAddr(1, 0));
+		TC.Equal(
+			CostsTo(Grid.Reachable(FVulHexAddr(0, 0), {}, Cached)),
+			CostsTo(Grid.Reachable(FVulHexAddr(0, 0), {}, Uncached)),
+			"Removed tile"
+		);
+
+		Grid.AddTile(FVulHexAddr(1, 0), TEXT("a"));
+		TC.Equal(
+			CostsTo(Grid.Reachable(FVulHexAddr(0, 0), {}, Cached)),
+			CostsTo(Grid.Reachable(FVulHexAddr(0, 0), {}, Uncached)),
+			"Re-added tile"
+		);
+
+		// A small edit at the edge of the grid should only re-search a small part of it.
+		CostFnCalls = 0;
+		Grid.Reachable(FVulHexAddr(0, 0), {}, Uncached);
+		const auto FullSearchCalls = CostFnCalls;
+
+		Grid.SetTileData(FVulHexAddr(5, 0), TEXT("aa"));
+		CostFnCalls = 0;
+		Grid.Reachable(FVulHexAddr(0, 0), {}, Cached);
+
+		TC.Equal(CostFnCalls < FullSearchCalls / 4, true, "Repair is incremental");
+
+		Grid.SetPathCacheCapacity(0);
+		CostFnCalls = 0;
+		Grid.Reachable(FVulHexAddr(0, 0), {}, Cached);
+
+		TC.Equal(CostFnCalls, FullSearchCalls, "Disabled cache");
+	});
+
+	VulTest::Case(this, "Path hierarchy", [](TC TC)
+	{
+		auto Grid = MakeGrid(12);
+		const auto Addrs = Grid.GetTileAddrs();
+		const TArray<FString> Data = {TEXT("a"), TEXT("a"), TEXT("aa"), TEXT("aaa"), TEXT("#")};
+		FRandomStream Rng(456);
+
+		for (const auto& Addr : Addrs)
+		{
+			Grid.SetTileData(Addr, Data[Rng.RandHelper(Data.Num())]);
+		}
+
+		int CostFnCalls = 0;
+
+		TestGrid::TVulQueryOptions Regular;
+		Regular.CostFn = [&CostFnCalls](const TestGrid::FVulTile& From, const TestGrid::FVulTile& To, const TestGrid* Grid) -> TOptional<int>
+		{
+			++CostFnCalls;
+
+			if (To.Data == TEXT("#"))
+			{
+				return {};
+			}
+
+			return To.Data.Len();
+		};
+
+		auto Hierarchical = Regular;
+		Hierarchical.CacheKey = FName("Test");
+
+		Grid.SetPathHierarchy(4, Hierarchical.CacheKey);
+
+		for (int Turn = 0; Turn < 10; ++Turn)
+		{
+			for (int Edit = 0; Edit < 3; ++Edit)
+			{
+				Grid.SetTileData(Addrs[Rng.RandHelper(Addrs.Num())], Data[Rng.RandHelper(Data.Num())]);
+			}
+
+			// A grid whose hierarchy is built from scratch should agree with one that's been rebuilt chunk by chunk.
+			auto Fresh = Grid;
+			Fresh.ClearPathHierarchy();
+
+			for (int Query = 0; Query < 10; ++Query)
+			{
+				const auto From = Addrs[Rng.RandHelper(Addrs.Num())];
+				const auto To = Addrs[Rng.RandHelper(Addrs.Num())];
+				const auto Msg = FString::Printf(TEXT("Turn %d from %s to %s"), Turn, *From.ToString(), *To.ToString());
+
+				const auto Expected = Grid.Path(From, To, Regular);
+				const auto Actual = Grid.Path(From, To, Hierarchical);
+
+				TC.Equal(Actual.Complete, Expected.Complete, Msg + TEXT(" complete"));
+				TC.Equal(Actual.Cost >= Expected.Cost, true, Msg + TEXT(" no cheaper than optimal"));
+				TC.Equal(Fresh.Path(From, To, Hierarchical).Cost, Actual.Cost, Msg + TEXT(" matches fresh hierarchy"));
+
+				if (!Actual.Complete)
+				{
+					continue;
+				}
+
+				auto Previous = Grid.TileAt(From);
+				int Cost = 0;
+				bool Walkable = true;
+
+				for (const auto& Tile : Actual.Tiles)
+				{
+					const auto Step = Regular.CostFn(Previous, Tile, &Grid);
+					Walkable &= Previous.Addr.Distance(Tile.Addr) == 1 && Step.IsSet();
+					Cost += Step.Get(0);
+					Previous = Tile;
+				}
+
+				TC.Equal(Walkable, true, Msg + TEXT(" walkable"));
+				TC.Equal(Cost, Actual.Cost, Msg + TEXT(" cost"));
+				TC.Equal(Previous.Addr, To, Msg + TEXT(" ends at destination"));
+			}
+		}
+
+		// An edit should only rebuild the chunks around it.
+		auto Fresh = Grid;
+		Fresh.ClearPathHierarchy();
+		const FVulHexAddr From(-12, 6), To(12, -6);
+
+		CostFnCalls = 0;
+		Fresh.Path(From, To, Hierarchical);
+		const auto FullBuildCalls = CostFnCalls;
+
+		Grid.Path(From, To, Hierarchical);
+		Grid.SetTileData(FVulHexAddr(0, 0), TEXT("aa"));
+		CostFnCalls = 0;
+		Grid.Path(From, To, Hierarchical);
+
+		TC.Equal(CostFnCalls < FullBuildCalls / 4, true, "Rebuild is incremental");
+
+		// Queries with other keys should search as usual, leaving the hierarchy alone.
+		auto Other = Regular;
+		Other.CacheKey = FName("Other");
+
+		TC.Equal(Grid.Path(From, To, Other).Cost, Grid.Path(From, To, Regular).Cost, "Other keys are exact");
+		CostFnCalls = 0;
+		Grid.Path(From, To, Hierarchical);
+		TC.Equal(CostFnCalls < FullBuildCalls / 4, true, "Other keys don't rebuild the hierarchy");
+	});
+
+	VulTest::Case(this, "Uniform path", [](TC TC)
+	{
+		auto Grid = MakeGrid(8);
+		const auto Addrs = Grid.GetTileAddrs();
+		FRandomStream Rng(321);
+
+		for (const auto& Addr : Addrs)
+		{
+			Grid.SetTileData(Addr, Rng.RandHelper(4) == 0 ? TEXT("#") : TEXT("a"));
+		}
+
+		TestGrid::TVulQueryOptions Regular;
+		Regular.CostFn = [](const TestGrid::FVulTile& From, const TestGrid::FVulTile& To, const TestGrid* Grid) -> TOptional<int>
+		{
+			if (To.Data == TEXT("#"))
+			{
+				return {};
+			}
+
+			return 1;
+		};
+
+		int PassableCalls = 0;
+
+		const auto Uniform = TestGrid::TVulQueryOptions::Uniform([&PassableCalls](const TestGrid::FVulTile& Tile)
+		{
+			++PassableCalls;
+			return Tile.Data != TEXT("#");
+		});
+
+		TestGrid::FSearchScratch Scratch;
+
+		for (int Query = 0; Query < 50; ++Query)
+		{
+			const auto From = Addrs[Rng.RandHelper(Addrs.Num())];
+			// Some destinations fall outside the grid.
+			const FVulHexAddr To(Rng.RandRange(-10, 10), Rng.RandRange(-10, 10));
+			const auto Msg = FString::Printf(TEXT("From %s to %s"), *From.ToString(), *To.ToString());
+
+			const auto Expected = Grid.Path(From, To, Regular);
+
+			PassableCalls = 0;
+			const auto Actual = Grid.Path(From, To, Uniform, Scratch);
+
+			TC.Equal(Actual.Complete, Expected.Complete, Msg + TEXT(" complete"));
+			TC.Equal(Actual.Cost, Expected.Cost, Msg + TEXT(" cost"));
+			TC.Equal(Actual.Tiles.Num(), Expected.Tiles.Num(), Msg + TEXT(" length"));
+			TC.Equal(PassableCalls <= Grid.TileCount(), true, Msg + TEXT(" passable checked once per tile"));
+
+			if (!Expected.Tiles.IsEmpty())
+			{
+				TC.Equal(Actual.Tiles.Last().Addr.Distance(To), Expected.Tiles.Last().Addr.Distance(To), Msg + TEXT(" gets as close"));
+			}
+
+			auto Previous = From;
+			bool Walkable = true;
+
+			for (const auto& Tile : Actual.Tiles)
+			{
+				Walkable &= Previous.Distance(Tile.Addr) == 1 && Tile.Data != TEXT("#");
+				Previous = Tile.Addr;
+			}
+
+			TC.Equal(Walkable, true, Msg + TEXT(" walkable"));
+		}
+	});
+
+	VulTest::Case(this, "Path batch", [](TC TC)
+	{
+		auto Grid = MakeGrid(10);
+		const auto Addrs = Grid.GetTileAddrs();
+		const TArray<FString> Data = {TEXT("a"), TEXT("aa"), TEXT("aaa"), TEXT("#")};
+		FRandomStream Rng(654);
+
+		for (const auto& Addr : Addrs)
+		{
+			Grid.SetTileData(Addr, Data[Rng.RandHelper(Data.Num())]);
+		}
+
+		TestGrid::TVulQueryOptions Weighted;
+		Weighted.CostFn = [](const TestGrid::FVulTile& From, const TestGrid::FVulTile& To, const TestGrid* Grid) -> TOptional<int>
+		{
+			if (To.Data == TEXT("#"))
+			{
+				return {};
+			}
+
+			return To.Data.Len();
+		};
+
+		const auto Uniform = TestGrid::TVulQueryOptions::Uniform([](const TestGrid::FVulTile& Tile)
+		{
+			return Tile.Data != TEXT("#");
+		});
+
+		TArray<TestGrid::FPathRequest> Requests;
+		Requests.Add({{0, 0}, {0, 0}, Weighted});
+		Requests.Add({{20, 0}, {0, 0}, Weighted});
+
+		for (int I = 0; I < 200; ++I)
+		{
+			const auto From = Addrs[Rng.RandHelper(Addrs.Num())];
+			const auto To = Addrs[Rng.RandHelper(Addrs.Num())];
+			Requests.Add({From, To, I % 2 == 0 ? Weighted : Uniform});
+		}
+
+		TArray<TestGrid::FPathResult> Results;
+		TArray<TestGrid::FSearchScratch> Scratches;
+
+		for (int Batch = 0; Batch < 2; ++Batch)
+		{
+			Grid.PathBatch(Requests, Results, Scratches);
+			TC.Equal(Results.Num(), Requests.Num(), "result per request");
+
+			for (int I = 0; I < Requests.Num(); ++I)
+			{
+				const auto& Request = Requests[I];
+				const auto Expected = Grid.Path(Request.From, Request.To, Request.Opts);
+				const auto Msg = FString::Printf(TEXT("Batch %d request %d"), Batch, I);
+
+				TC.Equal(Results[I].Complete, Expected.Complete, Msg + TEXT(" complete"));
+				TC.Equal(Results[I].Cost, Expected.Cost, Msg + TEXT(" cost"));
+				TC.Equal(Results[I].Addrs(), Expected.Addrs(), Msg + TEXT(" addrs"));
+			}
+		}
+
+		TC.Equal(Grid.PathBatch({}).Num(), 0, "empty batch");
+	});
+
+	VulTest::Case(this, "Connectivity", [](TC TC)
+	{
+		auto Grid = MakeGrid(6);
+		const auto Addrs = Grid.GetTileAddrs();
+
+		// A wall down Q=0 splits the grid in two.
+		for (const auto& Addr : Addrs)
+		{
+			Grid.SetTileData(Addr, Addr.Q == 0 ? TEXT("#") : TEXT("a"));
+		}
+
+		int CostFnCalls = 0;
+
+		TestGrid::TVulQueryOptions Regular;
+		Regular.CostFn = [&CostFnCalls](const TestGrid::FVulTile& From, const TestGrid::FVulTile& To, const TestGrid* Grid) -> TOptional<int>
+		{
+			++CostFnCalls;
+
+			if (To.Data == TEXT("#"))
+			{
+				return {};
+			}
+
+			return To.Data.Len();
+		};
+
+		auto Keyed = Regular;
+		Keyed.CacheKey = FName("Test");
+
+		Grid.SetConnectivity([](const TestGrid::FVulTile& Tile) { return Tile.Data != TEXT("#"); }, Keyed.CacheKey);
+
+		TC.Equal(Grid.IsConnected({-2, 0}, {-3, 5}), true, "same side");
+		TC.Equal(Grid.IsConnected({-2, 0}, {2, 0}), false, "across the wall");
+		TC.Equal(Grid.ComponentOf({0, 1}), INDEX_NONE, "wall has no component");
+
+		CostFnCalls = 0;
+		const auto Rejected = Grid.Path({-2, 0}, {2, 0}, Keyed);
+		TC.Equal(Rejected.Complete, false, "rejected path incomplete");
+		TC.Equal(Rejected.Tiles.Num(), 0, "rejected path empty");
+		TC.Equal(CostFnCalls, 0, "rejected without searching");
+
+		TC.Equal(Grid.Path({0, 0}, {2, 0}, Keyed).Complete, true, "impassable origin can leave");
+		TC.Equal(Grid.Path({2, 0}, {0, 0}, Keyed).Complete, false, "impassable destination");
+
+		Grid.SetTileData({0, 3}, TEXT("a"));
+		TC.Equal(Grid.IsConnected({-2, 0}, {2, 0}), true, "gap joins sides");
+		TC.Equal(Grid.Path({-2, 0}, {2, 0}, Keyed).Cost, Grid.Path({-2, 0}, {2, 0}, Regular).Cost, "path through gap");
+
+		Grid.RemoveTile({0, 3});
+		TC.Equal(Grid.IsConnected({-2, 0}, {2, 0}), false, "removing gap splits sides");
+		TC.Equal(Grid.IsConnected({2, 0}, {5, -5}), true, "side still connected after split");
+
+		// Incremental updates should agree with a regular search and with an index built from scratch.
+		const TArray<FString> Data = {TEXT("a"), TEXT("aa"), TEXT("#"), TEXT("#")};
+		FRandomStream Rng(789);
+
+		for (int Turn = 0; Turn < 20; ++Turn)
+		{
+			for (int Edit = 0; Edit < 3; ++Edit)
+			{
+				const auto& Addr = Addrs[Rng.RandHelper(Addrs.Num())];
+
+				if (Rng.RandHelper(10) == 0)
+				{
+					Grid.RemoveTile(Addr);
+				} else
+				{
+					Grid.AddTile(Addr, Data[Rng.RandHelper(Data.Num())]);
+				}
+			}
+
+			auto Fresh = Grid;
+			Fresh.ClearConnectivity();
+
+			for (int Query = 0; Query < 10; ++Query)
+			{
+				const auto From = Addrs[Rng.RandHelper(Addrs.Num())];
+				const auto To = Addrs[Rng.RandHelper(Addrs.Num())];
+				const auto Msg = FString::Printf(TEXT("Turn %d from %s to %s"), Turn, *From.ToString(), *To.ToString());
+
+				TC.Equal(Grid.Path(From, To, Keyed).Complete, Grid.Path(From, To, Regular).Complete, Msg + TEXT(" complete"));
+				TC.Equal(Grid.IsConnected(From, To), Fresh.IsConnected(From, To), Msg + TEXT(" matches fresh index"));
+			}
+		}
+	});
+
+	VulTest::Case(this, "Snapshots & deltas", [](TC TC)
+	{
+		const auto SameTiles = [&TC](const TestGrid& Actual, const TestGrid& Expected, const FString& Message)
+		{
+			TC.Equal(Actual.TileCount(), Expected.TileCount(), Message + " tile count");
+
+			for (const auto& Tile : Expected.GetTiles())
+			{
+				const auto Found = Actual.GetTile(Tile.Addr);
+				TC.Equal(Found.IsSet() ? Found->Data : TEXT("missing"), Tile.Data, Message + " " + Tile.Addr.ToString());
+			}
+		};
+
+		auto Source = MakeGrid(6);
+		Source.RemoveTile({2, 2});
+
+		TArray<uint8> Snapshot;
+		Source.SaveSnapshot(Snapshot);
+
+		TestGrid Replica;
+		TC.Equal(Replica.LoadSnapshot(Snapshot), true, "load snapshot");
+		SameTiles(Replica, Source, "snapshot");
+		TC.Equal(Replica.IsValidAddr({2, 2}), false, "removed tile is not in snapshot");
+		TC.Equal(Replica.NumChanges(), 0, "loading clears changes");
+
+		Source.ClearChanges();
+		Source.SetTileData({0, 0}, TEXT("changed"));
+		Source.ModifyTileData({1, -1})->Data = TEXT("modified");
+		Source.SetTileData({0, 0}, TEXT("changed again"));
+		Source.RemoveTile({-3, 1});
+		Source.AddTile({2, 2}, TEXT("re-added"));
+		Source.AddTile({10, -4}, TEXT("outside layout"));
+		TC.Equal(Source.NumChanges(), 5, "changes are tracked per tile");
+
+		TArray<uint8> Delta;
+		Source.SaveDelta(Delta);
+		TC.Equal(Source.NumChanges(), 0, "delta clears changes");
+		TC.Equal(Delta.Num() < Snapshot.Num() / 10, true, "delta is small");
+
+		TC.Equal(Replica.ApplyDelta(Delta), true, "apply delta");
+		SameTiles(Replica, Source, "delta");
+
+		TArray<uint8> Empty;
+		Source.SaveDelta(Empty);
+		TC.Equal(Replica.ApplyDelta(Empty), true, "apply empty delta");
+
+		// Corrupt or mismatched data is rejected, leaving the grid as it was.
+		const auto Truncated = TArray<uint8>(Snapshot.GetData(), Snapshot.Num() - 3);
+		TC.Equal(Replica.LoadSnapshot(Truncated), false, "truncated snapshot");
+		TC.Equal(Replica.LoadSnapshot(Delta), false, "delta is not a snapshot");
+		TC.Equal(Replica.ApplyDelta(Snapshot), false, "snapshot is not a delta");
+		TC.Equal(Replica.ApplyDelta(TArray<uint8>(Delta.GetData(), Delta.Num() - 1)), false, "truncated delta");
+		SameTiles(Replica, Source, "after rejected data");
+
+		// Custom tile serialization.
+		TVulHexgrid<FVector> Vectors(3, [](const FVulHexAddr& Addr) { return FVector(Addr.Q, Addr.R, Addr.S); });
+		const auto Serializer = [](FArchive& Ar, FVector& Data) { Ar << Data.X << Data.Y; };
+
+		TArray<uint8> VectorSnapshot;
+		Vectors.SaveSnapshot(VectorSnapshot, Serializer);
+
+		TVulHexgrid<FVector> VectorReplica;
+		TC.Equal(VectorReplica.LoadSnapshot(VectorSnapshot, Serializer), true, "load custom snapshot");
+		TC.Equal(VectorReplica.TileAt({2, -3}).Data, FVector(2, -3, 0), "custom serializer");
+	});
 
 	return true;
 }
@@ -0,0 +1,131 @@
+﻿#include "TestCase.h"
+#include "Hexgrid/VulHexOccupancy.h"
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	TestOccupancy,
+	"VulRuntime.Hexgrid.TestOccupancy",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter
+)
+
+using namespace VulTest;
+
+bool TestOccupancy::RunTest(const FString& Parameters)
+{
+	Case(this, "Add, move & remove", [](TC TC)
+	{
+		TVulHexOccupancy<int> Index;
+
+		Index.Add(1, {0, 0});
+		Index.Add(2, {0, 0});
+		Index.Add(3, {1, -1});
+
+		TC.Equal(Index.Num(), 3, "num");
+		TC.Equal(Index.NumAt({0, 0}), 2, "num at shared tile");
+		TC.Equal(Index.GetAt({0, 0}), TArray{1, 2}, "occupants in arrival order");
+		TC.Equal(Index.Find(3).GetValue(), FVulHexAddr(1, -1), "find");
+		TC.Equal(Index.IsOccupied({2, 0}), false, "unoccupied");
+
+		TC.Equal(Index.Move(1, {1, -1}), true, "move");
+		TC.Equal(Index.GetAt({0, 0}), TArray{2}, "moved from");
+		TC.Equal(Index.GetAt({1, -1}), TArray{3, 1}, "moved to");
+		TC.Equal(Index.Move(4, {1, -1}), false, "cannot move missing occupant");
+
+		Index.Add(2, {1, -1});
+		TC.Equal(Index.IsOccupied({0, 0}), false, "re-adding moves");
+		TC.Equal(Index.GetAt({1, -1}), TArray{3, 1, 2}, "re-added");
+
+		TC.Equal(Index.Remove(1), true, "remove");
+		TC.Equal(Index.Remove(1), false, "remove twice");
+		TC.Equal(Index.GetAt({1, -1}), TArray{3, 2}, "removed from middle");
+		TC.Equal(Index.Contains(1), false, "removed");
+
+		Index.Add(5, {1, -1});
+		TC.Equal(Index.GetAt({1, -1}), TArray{3, 2, 5}, "reused slot");
+		TC.Equal(Index.Num(), 3, "num after reuse");
+	});
+
+	Case(this, "Range", [](TC TC)
+	{
+		TVulHexOccupancy<int> Index;
+		TMap<int, FVulHexAddr> Expected;
+		FRandomStream Rng(123);
+
+		for (auto Step = 0; Step < 2000; ++Step)
+		{
+			const auto Occupant = Rng.RandRange(0, 199);
+			const FVulHexAddr Addr(Rng.RandRange(-10, 10), Rng.RandRange(-10, 10));
+
+			if (Rng.RandRange(0, 4) == 0)
+			{
+				Index.Remove(Occupant);
+				Expected.Remove(Occupant);
+			} else
+			{
+				Index.Add(Occupant, Addr);
+				Expected.Add(Occupant, Addr);
+			}
+		}
+
+		TC.Equal(Index.Num(), Expected.Num(), "num");
+
+		for (const auto& Center : TArray<FVulHexAddr>{{0, 0}, {8, -3}, {-12, 12}})
+		{
+			for (const auto Range : {0, 1, 3, 7})
+			{
+				TArray<int> BruteForce;
+
+				for (const auto& Entry : Expected)
+				{
+					if (Entry.Value.Distance(Center) <= Range)
+					{
+						BruteForce.Add(Entry.Key);
+					}
+				}
+
+				auto Actual = Index.GetInRange(Center, Range);
+
+				Index.ForEachInRange(Center, Range, [&](const int Occupant, const FVulHexAddr& Addr)
+				{
+					TC.Equal(Addr, Expected[Occupant], "occupant's tile");
+				});
+
+				BruteForce.Sort();
+				Actual.Sort();
+				TC.Equal(Actual, BruteForce, FString::Printf(TEXT("range %d of %s"), Range, *Center.ToString()));
+			}
+		}
+	});
+
+	Case(this, "World locations", [](TC TC)
+	{
+		const FVulWorldHexGridSettings Settings(10);
+		const FVector Origin(100, -50, 20);
+
+		TVulHexOccupancy<int> Index;
+		Index.SetWorldProjection(Settings, Origin);
+
+		FRandomStream Rng(456);
+		FVector Location = Origin;
+		auto Changes = 0;
+
+		for (auto Step = 0; Step < 3000; ++Step)
+		{
+			Location += FVector(Rng.FRandRange(-2, 2), Rng.FRandRange(-2, 2), 0);
+
+			const auto Before = Index.Find(1);
+			const auto Changed = Index.UpdateWorldLocation(1, Location);
+			const auto After = Index.Find(1).GetValue();
+
+			TC.Equal(After, VulRuntime::Hexgrid::Deproject(Location, Settings, Origin), "occupant is on deprojected tile");
+			TC.Equal(Changed, !Before.IsSet() || !(Before.GetValue() == After), "reports changes");
+
+			Changes += Changed ? 1 : 0;
+		}
+
+		TC.Equal(Changes > 1, true, "changed tile");
+		TC.Equal(Changes < 3000, true, "did not change every step");
+	});
+
+	return true;
+}
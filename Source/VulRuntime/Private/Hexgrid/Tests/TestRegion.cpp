@@ -0,0 +1,146 @@
+﻿#include "TestCase.h"
+#include "Hexgrid/VulHexgrid.h"
+#include "Hexgrid/VulHexRegion.h"
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	TestRegion,
+	"VulRuntime.Hexgrid.TestRegion",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter
+)
+
+using namespace VulTest;
+
+bool TestRegion::RunTest(const FString& Parameters)
+{
+	const auto Layout = FVulHexgridLayout::Hexagonal(8);
+
+	Case(this, "Membership", [Layout](TC TC)
+	{
+		FVulHexRegion Region(Layout);
+
+		TC.Equal(Region.IsEmpty(), true, "starts empty");
+		TC.Equal(Region.Add({0, 0}), true, "add");
+		TC.Equal(Region.Add({3, -1}), true, "add another");
+		TC.Equal(Region.Add({3, -1}), true, "add twice");
+		TC.Equal(Region.Add({20, 0}), false, "cannot add outside layout");
+
+		TC.Equal(Region.Num(), 2, "num");
+		TC.Equal(Region.Contains({3, -1}), true, "contains");
+		TC.Equal(Region.Contains({1, 0}), false, "does not contain");
+		TC.Equal(Region.Contains({20, 0}), false, "does not contain outside layout");
+
+		Region.Remove({0, 0});
+		TC.Equal(Region.GetAddrs(), TArray<FVulHexAddr>{{3, -1}}, "remove");
+
+		TArray<FVulHexAddr> Iterated;
+
+		for (const auto Addr : FVulHexRegion::Full(Layout))
+		{
+			Iterated.Add(Addr);
+		}
+
+		TC.Equal(Iterated.Num(), Layout.Num(), "iterates full region");
+		TC.Equal(Iterated.Last(), Layout.AddrOf(Layout.Num() - 1), "iterates in layout order");
+		TC.Equal(FVulHexRegion(Layout).begin() != FVulHexRegion(Layout).end(), false, "empty region iterates nothing");
+	});
+
+	Case(this, "Set algebra", [Layout](TC TC)
+	{
+		FVulHexRegion A(Layout), B(Layout);
+
+		for (const auto Addr : FVulHexRange({0, 0}, 2))
+		{
+			A.Add(Addr);
+		}
+
+		for (const auto Addr : FVulHexRange({2, 0}, 2))
+		{
+			B.Add(Addr);
+		}
+
+		TC.Equal((A | B).Num(), 19 + 19 - 9, "union");
+		TC.Equal((A & B).Num(), 9, "intersection");
+		TC.Equal((A - B).Num(), 19 - 9, "difference");
+		TC.Equal((A - B).Contains({2, 0}), false, "difference removes shared");
+		TC.Equal((A - B) | (A & B), A, "difference and intersection make the whole");
+	});
+
+	Case(this, "Dilate", [Layout](TC TC)
+	{
+		FRandomStream Rng(123);
+
+		for (int Trial = 0; Trial < 20; ++Trial)
+		{
+			FVulHexRegion Region(Layout);
+			FVulHexRegion Expected(Layout);
+			const auto Rings = Rng.RandRange(0, 3);
+
+			for (int I = 0; I < 4; ++I)
+			{
+				const FVulHexAddr Addr = Layout.AddrOf(Rng.RandHelper(Layout.Num()));
+				Region.Add(Addr);
+
+				for (const auto Near : FVulHexRange(Addr, Rings))
+				{
+					Expected.Add(Near);
+				}
+			}
+
+			TC.Equal(Region.Dilate(Rings), Expected, FString::Printf(TEXT("trial %d by %d rings"), Trial, Rings));
+		}
+
+		// A wall with one gap, so growth must go around.
+		auto Within = FVulHexRegion::Full(Layout);
+
+		for (int R = -8; R <= 8; ++R)
+		{
+			if (R != 4)
+			{
+				Within.Remove({0, R});
+			}
+		}
+
+		FVulHexRegion Region(Layout);
+		Region.Add({-1, 0});
+		Region.Dilate(3, &Within);
+
+		TC.Equal(Region.Contains({1, 0}), false, "does not cross wall");
+		TC.Equal(Region.Contains({-1, 3}), true, "grows towards the gap");
+		TC.Equal(Region.Contains({0, 4}), false, "gap is too far");
+		TC.Equal(Region.Dilate(100, &Within).Contains({1, 0}), true, "floods through the gap");
+	});
+
+	Case(this, "Grid regions", [](TC TC)
+	{
+		TVulHexgrid<int> Grid(5, [](const FVulHexAddr& Addr) { return Addr.Q + Addr.R; });
+		Grid.RemoveTile({1, 0});
+
+		const auto Tiles = Grid.TileRegion();
+		TC.Equal(Tiles.Num(), Grid.TileCount(), "tile region");
+		TC.Equal(Tiles.GetLayout(), Grid.GetLayout(), "laid out like the grid");
+
+		const auto Adjacent = Grid.AdjacentRegion({0, 0}, 2);
+		TC.Equal(Adjacent.Num(), Grid.AdjacentTiles({0, 0}, 2).Num(), "adjacent region");
+		TC.Equal(Adjacent.Contains({0, 0}), false, "excludes start");
+		TC.Equal(Adjacent.Contains({1, 0}), false, "excludes removed tile");
+
+		TArray<FVulHexAddr> FirstAddrs, SecondAddrs;
+		FVulHexRegion First, Second;
+		const auto Even = [](const TVulHexgrid<int>::FVulTile& Tile) { return Tile.Data % 2 == 0; };
+		Grid.SplitTiles(FirstAddrs, SecondAddrs, Even);
+		Grid.SplitTiles(First, Second, Even);
+
+		TC.Equal(First.GetAddrs().Num(), FirstAddrs.Num(), "split first");
+		TC.Equal(Second.GetAddrs().Num(), SecondAddrs.Num(), "split second");
+		TC.Equal(Grid.SelectTiles(Even), First | Second, "select");
+
+		const auto Selected = Grid.GetTiles(Grid.SelectTiles([](const TVulHexgrid<int>::FVulTile& Tile) { return Tile.Data == 4; }));
+		TC.Equal(Selected.Num(), 7, "get tiles in region");
+
+		const auto Reached = Grid.Reachable({0, 0}, 2);
+		TC.Equal(Reached.GetReachedRegion().GetAddrs().Num(), Reached.Num(), "reached region");
+	});
+
+	return true;
+}
@@ -156,5 +156,87 @@ bool TestUtil::RunTest(const FString& Parameters)
 		}, .5});
 	}
 
+	Case(this, "Batch projection", [](TC TC)
+	{
+		const FVulWorldHexGridSettings Settings(7.5f);
+		const FVulHexProjection Projection(Settings);
+		const auto Addrs = FVulHexAddr::GenerateGrid(6);
+		const auto Num = Addrs.Num();
+		constexpr float Scale = .8f;
+
+		TArray<FVector::FReal> X, Y;
+		TArray<int32> Indices;
+
+		const auto ToVectors = [&](const int32 Count)
+		{
+			TArray<FVector> Out;
+
+			for (int32 I = 0; I < Count; ++I)
+			{
+				Out.Add(FVector(X[I], Y[I], 0));
+			}
+
+			return Out;
+		};
+
+		TArray<FVector> Centers, Corners, Vertices;
+		TArray<FVulHexAddr> Deprojected;
+
+		for (const auto& Addr : Addrs)
+		{
+			const auto Center = VulRuntime::Hexgrid::Project(Addr, Settings);
+			const auto Points = VulRuntime::Hexgrid::Points(Addr, Settings, Scale);
+
+			Centers.Add(Center);
+			Corners.Append(Points);
+			Vertices.Add(Center);
+			Vertices.Append(Points);
+			Deprojected.Add(VulRuntime::Hexgrid::Deproject(Points[0] * .9 + Center * .1, Settings, FVector(3, -2, 0)));
+		}
+
+		X.SetNum(Num);
+		Y.SetNum(Num);
+		Projection.Project(Addrs, X, Y);
+		TC.Equal(ToVectors(Num), Centers, "Project");
+
+		X.SetNum(Num * 6);
+		Y.SetNum(Num * 6);
+		Projection.Points(Addrs, X, Y, Scale);
+		TC.Equal(ToVectors(Num * 6), Corners, "Points");
+
+		X.SetNum(Num * FVulHexProjection::VerticesPerTile);
+		Y.SetNum(Num * FVulHexProjection::VerticesPerTile);
+		Indices.SetNum(Num * FVulHexProjection::IndicesPerTile);
+		Projection.TriangleMesh(Addrs, X, Y, Indices, Scale, 10);
+		TC.Equal(ToVectors(Num * FVulHexProjection::VerticesPerTile), Vertices, "Mesh vertices");
+
+		const auto Mesh = ToVectors(Num * FVulHexProjection::VerticesPerTile);
+		const auto Expected = VulRuntime::Hexgrid::Triangles(Addrs[7], Settings, Scale);
+
+		for (int32 Tri = 0; Tri < 6; ++Tri)
+		{
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				const auto Index = Indices[7 * FVulHexProjection::IndicesPerTile + Tri * 3 + Corner] - 10;
+				TC.Equal(Mesh[Index], Expected[Tri][Corner], FString::Printf(TEXT("Triangle %d corner %d"), Tri, Corner));
+			}
+		}
+
+		// Points just inside each tile's first corner, offset by a grid origin.
+		TArray<FVector::FReal> WorldX, WorldY;
+
+		for (int32 I = 0; I < Num; ++I)
+		{
+			const auto Point = Corners[I * 6] * .9 + Centers[I] * .1 + FVector(3, -2, 0);
+			WorldX.Add(Point.X);
+			WorldY.Add(Point.Y);
+		}
+
+		TArray<FVulHexAddr> Out;
+		Out.SetNum(Num);
+		Projection.Deproject(WorldX, WorldY, Out, FVector(3, -2, 0));
+		TC.Equal(Out, Deprojected, "Deproject");
+	});
+
 	return true;
 }
@@ -1,4 +1,5 @@
 ﻿#include "Hexgrid/VulHexAddr.h"
+#include "Hexgrid/VulHexNeighbourhood.h"
 #include "Hexgrid/VulHexUtil.h"
 #include "Kismet/KismetMathLibrary.h"
 
@@ -34,14 +35,17 @@ FVulHexVector FVulHexAddr::Vector() const
 
 TArray<FVulHexAddr> FVulHexAddr::Adjacent() const
 {
-	return {
-		FVulHexAddr(Q + 1, R),
-		FVulHexAddr(Q, R + 1),
-		FVulHexAddr(Q - 1, R + 1),
-		FVulHexAddr(Q - 1, R),
-		FVulHexAddr(Q, R - 1),
-		FVulHexAddr(Q + 1, R - 1),
-	};
+	TArray<FVulHexAddr> Out;
+	Out.Reserve(6);
+
+	// Starting at +Q, unlike the ring order of AdjacentOffsets.
+	for (int I = 0; I < 6; ++I)
+	{
+		const auto& Offset = VulRuntime::Hexgrid::AdjacentOffsets[(I + 5) % 6];
+		Out.Add(FVulHexAddr(Q + Offset[0], R + Offset[1]));
+	}
+
+	return Out;
 }
 
 FVulHexAddr FVulHexAddr::Rotate(const FVulHexRotation& Rotation) const
@@ -102,7 +106,7 @@ FVulHexRotation FVulHexAddr::RotationTowards(const FVulHexAddr& Other) const
 
 bool FVulHexAddr::AdjacentTo(const FVulHexAddr& Other) const
 {
-	return Adjacent().Contains(Other);
+	return Distance(Other) == 1;
 }
 
 int FVulHexAddr::Distance(const FVulHexAddr& Other) const
@@ -110,36 +114,6 @@ int FVulHexAddr::Distance(const FVulHexAddr& Other) const
 	return (FMath::Abs(Other.Q - Q) + FMath::Abs(Other.R - R) + FMath::Abs(Other.S - S)) / 2;
 }
 
-TArray<int> FVulHexAddr::GenerateSequenceForRing(const int Ring)
-{
-	auto AtLimitFor = 0;
-	auto Current = 0;
-	auto Direction = -1;
-	TArray<int> Out;
-
-	do
-	{
-		auto New = FMath::Clamp(Current, -Ring, Ring);
-		Out.Add(New);
-
-		if (New == -Ring || New == Ring)
-		{
-			if (++AtLimitFor > Ring)
-			{
-				Direction *= -1;
-				Current = New;
-			}
-		} else
-		{
-			AtLimitFor = 0;
-		}
-
-		Current += Direction;
-	} while (Out.Num() < Ring * 6);
-
-	return Out;
-}
-
 bool FVulHexAddr::IsValid() const
 {
 	return Q + R + S == 0;
@@ -147,11 +121,14 @@ bool FVulHexAddr::IsValid() const
 
 TArray<FVulHexAddr> FVulHexAddr::GenerateGrid(const int Size)
 {
+	const FVulHexSpiral Spiral(Origin(), Size);
+
 	TArray<FVulHexAddr> Out;
+	Out.Reserve(Spiral.Num());
 
-	for (auto Ring = 0; Ring <= Size; Ring++)
+	for (const auto Addr : Spiral)
 	{
-		GenerateRing(Ring, Out);
+		Out.Add(Addr);
 	}
 
 	return Out;
@@ -159,20 +136,12 @@ TArray<FVulHexAddr> FVulHexAddr::GenerateGrid(const int Size)
 
 void FVulHexAddr::GenerateRing(const int N, TArray<FVulHexAddr>& Out)
 {
-	if (N == 0)
-	{
-		Out.Add(FVulHexAddr(0, 0));
-		return;
-	}
-
-	const auto Seq = GenerateSequenceForRing(N);
-
-	auto Q = 0;
-	auto R = Seq.Num() - N * 2;
+	const FVulHexRing Ring(Origin(), N);
+	Out.Reserve(Out.Num() + Ring.Num());
 
-	for (auto I = 0; I < N * 6; I++)
+	for (const auto Addr : Ring)
 	{
-		Out.Add(FVulHexAddr(Seq[Q++ % Seq.Num()], Seq[R++ % Seq.Num()]));
+		Out.Add(Addr);
 	}
 }
 
@@ -0,0 +1,241 @@
+﻿#include "Hexgrid/VulHexRegion.h"
+
+namespace
+{
+	int32 NumWords(const FVulHexgridLayout& Layout)
+	{
+		return (Layout.Num() + 63) / 64;
+	}
+
+	/**
+	 * ORs In, moved Shift bits towards higher indices (or lower, if negative), in to Out.
+	 */
+	void OrShifted(TArray<uint64>& Out, const TArray<uint64>& In, const int32 Shift)
+	{
+		const auto Num = In.Num();
+		const auto WordShift = FMath::Abs(Shift) / 64;
+		const auto BitShift = FMath::Abs(Shift) % 64;
+
+		for (int32 Word = 0; Word < Num; ++Word)
+		{
+			if (Shift >= 0)
+			{
+				const auto From = Word - WordShift;
+
+				if (From >= 0)
+				{
+					Out[Word] |= In[From] << BitShift;
+				}
+
+				if (BitShift != 0 && From - 1 >= 0)
+				{
+					Out[Word] |= In[From - 1] >> (64 - BitShift);
+				}
+			} else
+			{
+				const auto From = Word + WordShift;
+
+				if (From < Num)
+				{
+					Out[Word] |= In[From] >> BitShift;
+				}
+
+				if (BitShift != 0 && From + 1 < Num)
+				{
+					Out[Word] |= In[From + 1] << (64 - BitShift);
+				}
+			}
+		}
+	}
+}
+
+FVulHexRegion::FVulHexRegion(const FVulHexgridLayout& InLayout) : Layout(InLayout)
+{
+	Words.Init(0, NumWords(Layout));
+}
+
+FVulHexRegion FVulHexRegion::Full(const FVulHexgridLayout& InLayout)
+{
+	FVulHexRegion Out(InLayout);
+
+	for (auto& Word : Out.Words)
+	{
+		Word = ~uint64(0);
+	}
+
+	if (const auto Tail = InLayout.Num() % 64; Tail != 0)
+	{
+		Out.Words.Last() = (uint64(1) << Tail) - 1;
+	}
+
+	return Out;
+}
+
+bool FVulHexRegion::Add(const FVulHexAddr& Addr)
+{
+	const auto Index = Layout.IndexOf(Addr);
+
+	if (Index == INDEX_NONE)
+	{
+		return false;
+	}
+
+	AddIndex(Index);
+	return true;
+}
+
+void FVulHexRegion::Remove(const FVulHexAddr& Addr)
+{
+	if (const auto Index = Layout.IndexOf(Addr); Index != INDEX_NONE)
+	{
+		RemoveIndex(Index);
+	}
+}
+
+int32 FVulHexRegion::Num() const
+{
+	int32 Out = 0;
+
+	for (const auto Word : Words)
+	{
+		Out += static_cast<int32>(FMath::CountBits(Word));
+	}
+
+	return Out;
+}
+
+bool FVulHexRegion::IsEmpty() const
+{
+	for (const auto Word : Words)
+	{
+		if (Word != 0)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void FVulHexRegion::Reset()
+{
+	for (auto& Word : Words)
+	{
+		Word = 0;
+	}
+}
+
+FVulHexRegion& FVulHexRegion::Union(const FVulHexRegion& Other)
+{
+	CheckSameLayout(Other);
+
+	for (int32 Word = 0; Word < Words.Num(); ++Word)
+	{
+		Words[Word] |= Other.Words[Word];
+	}
+
+	return *this;
+}
+
+FVulHexRegion& FVulHexRegion::Intersect(const FVulHexRegion& Other)
+{
+	CheckSameLayout(Other);
+
+	for (int32 Word = 0; Word < Words.Num(); ++Word)
+	{
+		Words[Word] &= Other.Words[Word];
+	}
+
+	return *this;
+}
+
+FVulHexRegion& FVulHexRegion::Difference(const FVulHexRegion& Other)
+{
+	CheckSameLayout(Other);
+
+	for (int32 Word = 0; Word < Words.Num(); ++Word)
+	{
+		Words[Word] &= ~Other.Words[Word];
+	}
+
+	return *this;
+}
+
+FVulHexRegion& FVulHexRegion::Dilate(const int Rings, const FVulHexRegion* Within)
+{
+	checkf(Rings >= 0, TEXT("Hex region dilation must not be negative"))
+
+	if (Within != nullptr)
+	{
+		CheckSameLayout(*Within);
+	}
+
+	// Neighbours are a fixed offset apart in layout order, bar moves off either side of a row, which
+	// would wrap to the other end of an adjacent row. So mask out the columns that cannot move that way.
+	const auto Width = Layout.GetWidth();
+	auto Clamp = Within != nullptr ? *Within : Full(Layout);
+	auto NotFirstColumn = Full(Layout);
+	auto NotLastColumn = Full(Layout);
+
+	for (int32 Row = 0; Row < Layout.GetHeight(); ++Row)
+	{
+		NotFirstColumn.RemoveIndex(Row * Width);
+		NotLastColumn.RemoveIndex(Row * Width + Width - 1);
+	}
+
+	TArray<uint64> Masked;
+	Masked.SetNumUninitialized(Words.Num());
+
+	for (int Ring = 0; Ring < Rings; ++Ring)
+	{
+		const auto Previous = Words;
+
+		for (const auto& Offset : VulRuntime::Hexgrid::AdjacentOffsets)
+		{
+			const auto& ColumnMask = Offset[0] > 0 ? NotLastColumn : NotFirstColumn;
+
+			for (int32 Word = 0; Word < Words.Num(); ++Word)
+			{
+				Masked[Word] = Offset[0] != 0 ? Previous[Word] & ColumnMask.Words[Word] : Previous[Word];
+			}
+
+			OrShifted(Words, Masked, Offset[0] + Offset[1] * Width);
+		}
+
+		// Also clears anything shifted past the end of the layout.
+		for (int32 Word = 0; Word < Words.Num(); ++Word)
+		{
+			Words[Word] &= Clamp.Words[Word] | Previous[Word];
+		}
+
+		if (Words == Previous)
+		{
+			break;
+		}
+	}
+
+	return *this;
+}
+
+TArray<FVulHexAddr> FVulHexRegion::GetAddrs() const
+{
+	TArray<FVulHexAddr> Out;
+	Out.Reserve(Num());
+
+	ForEachIndex([&](const int32 Index)
+	{
+		Out.Add(Layout.AddrOf(Index));
+	});
+
+	return Out;
+}
+
+void FVulHexRegion::CheckSameLayout(const FVulHexRegion& Other) const
+{
+	checkf(
+		Layout == Other.Layout,
+		TEXT("Cannot combine hex regions with different layouts: %s and %s"),
+		*Layout.ToString(),
+		*Other.Layout.ToString()
+	)
+}
@@ -2,6 +2,149 @@
 #include "Hexgrid/VulHexAddr.h"
 #include "Kismet/KismetMathLibrary.h"
 
+FVulHexProjection::FVulHexProjection(const FVulWorldHexGridSettings& GridSettings)
+	: ShortStep(GridSettings.ShortStep()), LongStep(GridSettings.LongStep())
+{
+	for (auto N = 0; N < 6; ++N)
+	{
+		CornerX[N] = UKismetMathLibrary::DegCos(30 + 60 * N) * GridSettings.HexSize;
+		CornerY[N] = UKismetMathLibrary::DegSin(30 + 60 * N) * GridSettings.HexSize;
+	}
+}
+
+void FVulHexProjection::Project(
+	TConstArrayView<FVulHexAddr> Addrs,
+	TArrayView<FReal> OutX,
+	TArrayView<FReal> OutY
+) const {
+	checkf(OutX.Num() >= Addrs.Num() && OutY.Num() >= Addrs.Num(), TEXT("Projection output buffers are too small"))
+
+	const auto Num = Addrs.Num();
+	const FVulHexAddr* RESTRICT In = Addrs.GetData();
+	FReal* RESTRICT X = OutX.GetData();
+	FReal* RESTRICT Y = OutY.GetData();
+
+	for (int32 I = 0; I < Num; ++I)
+	{
+		X[I] = 2 * ShortStep * In[I].Q + ShortStep * In[I].R;
+		Y[I] = LongStep * -In[I].R;
+	}
+}
+
+void FVulHexProjection::Points(
+	TConstArrayView<FVulHexAddr> Addrs,
+	TArrayView<FReal> OutX,
+	TArrayView<FReal> OutY,
+	const float Scale
+) const {
+	checkf(OutX.Num() >= Addrs.Num() * 6 && OutY.Num() >= Addrs.Num() * 6, TEXT("Projection output buffers are too small"))
+
+	FReal ScaledX[6];
+	FReal ScaledY[6];
+
+	for (auto N = 0; N < 6; ++N)
+	{
+		ScaledX[N] = CornerX[N] * Scale;
+		ScaledY[N] = CornerY[N] * Scale;
+	}
+
+	const auto Num = Addrs.Num();
+	const FVulHexAddr* RESTRICT In = Addrs.GetData();
+	FReal* RESTRICT X = OutX.GetData();
+	FReal* RESTRICT Y = OutY.GetData();
+
+	for (int32 I = 0; I < Num; ++I)
+	{
+		const FReal CenterX = 2 * ShortStep * In[I].Q + ShortStep * In[I].R;
+		const FReal CenterY = LongStep * -In[I].R;
+
+		for (auto N = 0; N < 6; ++N)
+		{
+			X[I * 6 + N] = CenterX + ScaledX[N];
+			Y[I * 6 + N] = CenterY + ScaledY[N];
+		}
+	}
+}
+
+void FVulHexProjection::TriangleMesh(
+	TConstArrayView<FVulHexAddr> Addrs,
+	TArrayView<FReal> OutX,
+	TArrayView<FReal> OutY,
+	TArrayView<int32> OutIndices,
+	const float Scale,
+	const int32 BaseVertex
+) const {
+	checkf(
+		OutX.Num() >= Addrs.Num() * VerticesPerTile
+			&& OutY.Num() >= Addrs.Num() * VerticesPerTile
+			&& OutIndices.Num() >= Addrs.Num() * IndicesPerTile,
+		TEXT("Projection output buffers are too small")
+	)
+
+	// Vertex 0 is the center, 1-6 are corners 0-5. Triangle N is corners N-1, center, N as per Triangles.
+	static constexpr int32 TileIndices[IndicesPerTile] = {6, 0, 1, 1, 0, 2, 2, 0, 3, 3, 0, 4, 4, 0, 5, 5, 0, 6};
+
+	FReal OffsetX[VerticesPerTile] = {0};
+	FReal OffsetY[VerticesPerTile] = {0};
+
+	for (auto N = 0; N < 6; ++N)
+	{
+		OffsetX[N + 1] = CornerX[N] * Scale;
+		OffsetY[N + 1] = CornerY[N] * Scale;
+	}
+
+	const auto Num = Addrs.Num();
+	const FVulHexAddr* RESTRICT In = Addrs.GetData();
+	FReal* RESTRICT X = OutX.GetData();
+	FReal* RESTRICT Y = OutY.GetData();
+	int32* RESTRICT Indices = OutIndices.GetData();
+
+	for (int32 I = 0; I < Num; ++I)
+	{
+		const FReal CenterX = 2 * ShortStep * In[I].Q + ShortStep * In[I].R;
+		const FReal CenterY = LongStep * -In[I].R;
+
+		for (auto N = 0; N < VerticesPerTile; ++N)
+		{
+			X[I * VerticesPerTile + N] = CenterX + OffsetX[N];
+			Y[I * VerticesPerTile + N] = CenterY + OffsetY[N];
+		}
+
+		const auto FirstVertex = BaseVertex + I * VerticesPerTile;
+
+		for (auto N = 0; N < IndicesPerTile; ++N)
+		{
+			Indices[I * IndicesPerTile + N] = FirstVertex + TileIndices[N];
+		}
+	}
+}
+
+void FVulHexProjection::Deproject(
+	TConstArrayView<FReal> X,
+	TConstArrayView<FReal> Y,
+	TArrayView<FVulHexAddr> Out,
+	const FVector& GridOrigin
+) const {
+	checkf(X.Num() == Y.Num(), TEXT("Deprojection input buffers must be the same length"))
+	checkf(Out.Num() >= X.Num(), TEXT("Deprojection output buffer is too small"))
+
+	const auto Num = X.Num();
+	const FReal* RESTRICT InX = X.GetData();
+	const FReal* RESTRICT InY = Y.GetData();
+	FVulHexAddr* RESTRICT Addrs = Out.GetData();
+
+	for (int32 I = 0; I < Num; ++I)
+	{
+		const int R = FMath::RoundToInt((InY[I] - GridOrigin.Y) / LongStep * -1);
+		const int Q = FMath::RoundToInt((InX[I] - GridOrigin.X - ShortStep * R) / 2.0 / ShortStep);
+
+		// Always valid, so skip the checks in FVulHexAddr's constructor.
+		Addrs[I].Q = Q;
+		Addrs[I].R = R;
+		Addrs[I].S = -Q - R;
+	}
+}
+
 FTransform VulRuntime::Hexgrid::CalculateMeshTransformation(
 	const FBox& HexMeshBoundingBox,
 	const FVulWorldHexGridSettings& GridSettings)
@@ -0,0 +1,58 @@
+﻿#include "Hexgrid/VulHexgridLayout.h"
+
+FVulHexgridLayout::FVulHexgridLayout(const int InMinQ, const int InMinR, const int InWidth, const int InHeight)
+	: MinQ(InMinQ), MinR(InMinR), Width(InWidth), Height(InHeight)
+{
+	checkf(Width >= 0 && Height >= 0, TEXT("Hexgrid layout dimensions must not be negative"))
+}
+
+FVulHexgridLayout FVulHexgridLayout::Hexagonal(const int Size)
+{
+	return FVulHexgridLayout(-Size, -Size, Size * 2 + 1, Size * 2 + 1);
+}
+
+FVulHexgridLayout FVulHexgridLayout::Expand(const FVulHexAddr& Addr) const
+{
+	if (Num() == 0)
+	{
+		return FVulHexgridLayout(Addr.Q, Addr.R, 1, 1);
+	}
+
+	if (Contains(Addr))
+	{
+		return *this;
+	}
+
+	auto NewMinQ = MinQ;
+	auto NewMinR = MinR;
+	auto NewMaxQ = MinQ + Width - 1;
+	auto NewMaxR = MinR + Height - 1;
+
+	// Grow by half the current extent in any direction we need to, so that
+	// building a grid tile-by-tile re-lays out a logarithmic number of times.
+	const auto GrowQ = FMath::Max(Width / 2, 1);
+	const auto GrowR = FMath::Max(Height / 2, 1);
+
+	if (Addr.Q < NewMinQ)
+	{
+		NewMinQ = FMath::Min(Addr.Q, NewMinQ - GrowQ);
+	} else if (Addr.Q > NewMaxQ)
+	{
+		NewMaxQ = FMath::Max(Addr.Q, NewMaxQ + GrowQ);
+	}
+
+	if (Addr.R < NewMinR)
+	{
+		NewMinR = FMath::Min(Addr.R, NewMinR - GrowR);
+	} else if (Addr.R > NewMaxR)
+	{
+		NewMaxR = FMath::Max(Addr.R, NewMaxR + GrowR);
+	}
+
+	return FVulHexgridLayout(NewMinQ, NewMinR, NewMaxQ - NewMinQ + 1, NewMaxR - NewMinR + 1);
+}
+
+FString FVulHexgridLayout::ToString() const
+{
+	return FString::Printf(TEXT("Q=[%d, %d) R=[%d, %d)"), MinQ, MinQ + Width, MinR, MinR + Height);
+}
@@ -0,0 +1,461 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * A binary min-heap priority queue supporting changing the priority of queued elements.
+ *
+ * Each added element is assigned a handle, which can later be used to update its priority
+ * (e.g. decrease-key in Dijkstra/A*) rather than adding a duplicate entry. Handles, and the
+ * elements they refer to, remain valid until the queue is Reset, including after the element
+ * has been popped.
+ *
+ * Predicate is a template parameter so comparisons are inlined. Predicate(A, B) returns true
+ * if priority A comes out of the queue before priority B. By default, lower values are higher
+ * priority.
+ *
+ * Reset retains allocated memory, so a queue that is reused across searches stops allocating
+ * once it has grown to its working size.
+ *
+ * This is not threadsafe.
+ */
+template <typename ElementType, typename PriorityType, typename PredicateType = TLess<PriorityType>>
+class TVulIndexedPriorityQueue
+{
+public:
+	typedef int32 FHandle;
+
+	TVulIndexedPriorityQueue() = default;
+
+	explicit TVulIndexedPriorityQueue(const PredicateType& InPredicate) : Predicate(InPredicate) {}
+
+	/**
+	 * Preallocates memory for the given number of elements.
+	 */
+	void Reserve(const int32 Number)
+	{
+		Nodes.Reserve(Number);
+		Heap.Reserve(Number);
+	}
+
+	/**
+	 * Removes all elements, invalidating all handles, but keeps allocated memory.
+	 */
+	void Reset()
+	{
+		Nodes.Reset();
+		HeapNum = 0;
+	}
+
+	/**
+	 * Adds an element with the given priority, returning a handle to refer to it later.
+	 */
+	FHandle Add(const ElementType& Element, const PriorityType Priority)
+	{
+		const FHandle Handle = Nodes.Add({Element, HeapNum});
+
+		if (HeapNum < Heap.Num())
+		{
+			Heap[HeapNum] = {Priority, Handle};
+		} else
+		{
+			Heap.Add({Priority, Handle});
+		}
+
+		SiftUp(HeapNum++);
+		return Handle;
+	}
+
+	/**
+	 * Changes the priority of a queued element, moving it up or down the queue as needed.
+	 */
+	void Update(const FHandle Handle, const PriorityType Priority)
+	{
+		checkf(IsQueued(Handle), TEXT("Cannot update the priority of an element that is not queued"))
+
+		const auto HeapIndex = Nodes[Handle].HeapIndex;
+		const bool Raised = Predicate(Priority, Heap[HeapIndex].Priority);
+		Heap[HeapIndex].Priority = Priority;
+
+		if (Raised)
+		{
+			SiftUp(HeapIndex);
+		} else
+		{
+			SiftDown(HeapIndex);
+		}
+	}
+
+	/**
+	 * True if Handle refers to an element that is still in the queue.
+	 */
+	FORCEINLINE bool IsQueued(const FHandle Handle) const
+	{
+		return Nodes.IsValidIndex(Handle) && Nodes[Handle].HeapIndex != INDEX_NONE;
+	}
+
+	/**
+	 * Removes the highest-priority element from the queue and returns its handle.
+	 *
+	 * The queue must not be empty.
+	 */
+	FHandle Pop()
+	{
+		checkf(!IsEmpty(), TEXT("Cannot pop from an empty priority queue"))
+
+		const auto Handle = Heap[0].Handle;
+		Nodes[Handle].HeapIndex = INDEX_NONE;
+
+		// Heap entries beyond HeapNum are left in place so a reused queue does not reallocate.
+		if (--HeapNum > 0)
+		{
+			Heap[0] = Heap[HeapNum];
+			SiftDown(0);
+		}
+
+		return Handle;
+	}
+
+	/**
+	 * Returns the handle of the highest-priority element without removing it.
+	 *
+	 * The queue must not be empty.
+	 */
+	FHandle Top() const
+	{
+		checkf(!IsEmpty(), TEXT("Cannot get the top of an empty priority queue"))
+		return Heap[0].Handle;
+	}
+
+	/**
+	 * Returns the element a handle refers to. Valid until the queue is Reset.
+	 */
+	FORCEINLINE const ElementType& GetElement(const FHandle Handle) const
+	{
+		return Nodes[Handle].Element;
+	}
+
+	/**
+	 * Returns the priority of a queued element.
+	 */
+	FORCEINLINE PriorityType GetPriority(const FHandle Handle) const
+	{
+		checkf(IsQueued(Handle), TEXT("Cannot get the priority of an element that is not queued"))
+		return Heap[Nodes[Handle].HeapIndex].Priority;
+	}
+
+	FORCEINLINE bool IsEmpty() const
+	{
+		return HeapNum == 0;
+	}
+
+	/**
+	 * The number of elements currently queued.
+	 */
+	FORCEINLINE int32 Num() const
+	{
+		return HeapNum;
+	}
+
+private:
+	struct FNode
+	{
+		ElementType Element;
+
+		/**
+		 * Where this node is in Heap, or INDEX_NONE once popped.
+		 */
+		int32 HeapIndex;
+	};
+
+	/**
+	 * Heap entries carry their priority so comparisons don't need to look up the node.
+	 */
+	struct FHeapEntry
+	{
+		PriorityType Priority;
+		FHandle Handle;
+	};
+
+	void SiftUp(int32 Index)
+	{
+		const auto Moving = Heap[Index];
+
+		while (Index > 0)
+		{
+			const auto Parent = (Index - 1) / 2;
+
+			if (!Predicate(Moving.Priority, Heap[Parent].Priority))
+			{
+				break;
+			}
+
+			Heap[Index] = Heap[Parent];
+			Nodes[Heap[Index].Handle].HeapIndex = Index;
+			Index = Parent;
+		}
+
+		Heap[Index] = Moving;
+		Nodes[Moving.Handle].HeapIndex = Index;
+	}
+
+	void SiftDown(int32 Index)
+	{
+		const auto Moving = Heap[Index];
+		const auto Count = HeapNum;
+
+		while (true)
+		{
+			auto Child = Index * 2 + 1;
+
+			if (Child >= Count)
+			{
+				break;
+			}
+
+			if (Child + 1 < Count && Predicate(Heap[Child + 1].Priority, Heap[Child].Priority))
+			{
+				++Child;
+			}
+
+			if (!Predicate(Heap[Child].Priority, Moving.Priority))
+			{
+				break;
+			}
+
+			Heap[Index] = Heap[Child];
+			Nodes[Heap[Index].Handle].HeapIndex = Index;
+			Index = Child;
+		}
+
+		Heap[Index] = Moving;
+		Nodes[Moving.Handle].HeapIndex = Index;
+	}
+
+	PredicateType Predicate;
+	TArray<FNode> Nodes;
+
+	/**
+	 * The first HeapNum entries form the heap.
+	 */
+	TArray<FHeapEntry> Heap;
+	int32 HeapNum = 0;
+};
+
+/**
+ * A bucketed priority queue for small, non-negative integer priorities, where lower values are
+ * higher priority.
+ *
+ * Offers the same interface as @see TVulIndexedPriorityQueue, but adding, updating and popping are
+ * all O(1) (amortized over the range of priorities). This suits searches over grids with small
+ * integer costs, whose priorities are bounded by the longest path cost.
+ *
+ * Elements with equal priority come out of the queue in the order they were added (or last updated),
+ * or the reverse of that if bNewestFirst.
+ *
+ * Memory use grows with the largest priority added. Reset retains allocated memory.
+ *
+ * This is not threadsafe.
+ */
+template <typename ElementType, typename PriorityType = int32, bool bNewestFirst = false>
+class TVulBucketPriorityQueue
+{
+	static_assert(TIsIntegral<PriorityType>::Value, "TVulBucketPriorityQueue requires an integral priority type");
+
+public:
+	typedef int32 FHandle;
+
+	/**
+	 * Preallocates memory for the given number of elements and priorities up to MaxPriority.
+	 */
+	void Reserve(const int32 Number, const PriorityType MaxPriority = 0)
+	{
+		Nodes.Reserve(Number);
+
+		if (Buckets.Num() <= MaxPriority)
+		{
+			Buckets.SetNum(MaxPriority + 1);
+		}
+	}
+
+	/**
+	 * Removes all elements, invalidating all handles, but keeps allocated memory.
+	 */
+	void Reset()
+	{
+		for (auto& Bucket : Buckets)
+		{
+			Bucket = FBucket();
+		}
+
+		Nodes.Reset();
+		Cursor = 0;
+		Count = 0;
+	}
+
+	FHandle Add(const ElementType& Element, const PriorityType Priority)
+	{
+		const FHandle Handle = Nodes.Add({Element, Priority});
+		Link(Handle);
+		++Count;
+		return Handle;
+	}
+
+	void Update(const FHandle Handle, const PriorityType Priority)
+	{
+		checkf(IsQueued(Handle), TEXT("Cannot update the priority of an element that is not queued"))
+
+		Unlink(Handle);
+		Nodes[Handle].Priority = Priority;
+		Link(Handle);
+	}
+
+	FORCEINLINE bool IsQueued(const FHandle Handle) const
+	{
+		return Nodes.IsValidIndex(Handle) && Nodes[Handle].bQueued;
+	}
+
+	FHandle Pop()
+	{
+		const auto Handle = Top();
+		Unlink(Handle);
+		--Count;
+		return Handle;
+	}
+
+	FHandle Top() const
+	{
+		checkf(!IsEmpty(), TEXT("Cannot get the top of an empty priority queue"))
+
+		while (Buckets[Cursor].Head == INDEX_NONE)
+		{
+			++Cursor;
+		}
+
+		return Buckets[Cursor].Head;
+	}
+
+	FORCEINLINE const ElementType& GetElement(const FHandle Handle) const
+	{
+		return Nodes[Handle].Element;
+	}
+
+	FORCEINLINE PriorityType GetPriority(const FHandle Handle) const
+	{
+		checkf(IsQueued(Handle), TEXT("Cannot get the priority of an element that is not queued"))
+		return Nodes[Handle].Priority;
+	}
+
+	FORCEINLINE bool IsEmpty() const
+	{
+		return Count == 0;
+	}
+
+	FORCEINLINE int32 Num() const
+	{
+		return Count;
+	}
+
+private:
+	struct FNode
+	{
+		ElementType Element;
+		PriorityType Priority;
+		int32 Prev = INDEX_NONE;
+		int32 Next = INDEX_NONE;
+		bool bQueued = false;
+	};
+
+	/**
+	 * A doubly-linked list of the nodes with a given priority.
+	 */
+	struct FBucket
+	{
+		int32 Head = INDEX_NONE;
+		int32 Tail = INDEX_NONE;
+	};
+
+	void Link(const FHandle Handle)
+	{
+		auto& Node = Nodes[Handle];
+		checkf(Node.Priority >= 0, TEXT("TVulBucketPriorityQueue priorities must not be negative"))
+
+		const auto BucketIndex = static_cast<int32>(Node.Priority);
+
+		if (BucketIndex >= Buckets.Num())
+		{
+			Buckets.SetNum(BucketIndex + 1);
+		}
+
+		auto& Bucket = Buckets[BucketIndex];
+		Node.bQueued = true;
+
+		if constexpr (bNewestFirst)
+		{
+			Node.Prev = INDEX_NONE;
+			Node.Next = Bucket.Head;
+
+			if (Bucket.Head != INDEX_NONE)
+			{
+				Nodes[Bucket.Head].Prev = Handle;
+			} else
+			{
+				Bucket.Tail = Handle;
+			}
+
+			Bucket.Head = Handle;
+		} else
+		{
+			Node.Prev = Bucket.Tail;
+			Node.Next = INDEX_NONE;
+
+			if (Bucket.Tail != INDEX_NONE)
+			{
+				Nodes[Bucket.Tail].Next = Handle;
+			} else
+			{
+				Bucket.Head = Handle;
+			}
+
+			Bucket.Tail = Handle;
+		}
+
+		Cursor = FMath::Min(Cursor, BucketIndex);
+	}
+
+	void Unlink(const FHandle Handle)
+	{
+		auto& Node = Nodes[Handle];
+		auto& Bucket = Buckets[static_cast<int32>(Node.Priority)];
+
+		if (Node.Prev != INDEX_NONE)
+		{
+			Nodes[Node.Prev].Next = Node.Next;
+		} else
+		{
+			Bucket.Head = Node.Next;
+		}
+
+		if (Node.Next != INDEX_NONE)
+		{
+			Nodes[Node.Next].Prev = Node.Prev;
+		} else
+		{
+			Bucket.Tail = Node.Prev;
+		}
+
+		Node.Prev = INDEX_NONE;
+		Node.Next = INDEX_NONE;
+		Node.bQueued = false;
+	}
+
+	TArray<FNode> Nodes;
+	TArray<FBucket> Buckets;
+
+	/**
+	 * No bucket before this index has any elements in it.
+	 */
+	mutable int32 Cursor = 0;
+
+	int32 Count = 0;
+};
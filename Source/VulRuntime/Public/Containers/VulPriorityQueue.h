@@ -19,7 +19,7 @@ public:
 
 		bool operator<(const FEntry& Other) const
 		{
-			return Other.Priority < Other;
+			return Priority < Other.Priority;
 		}
 	};
 
@@ -382,7 +382,23 @@ struct TVulFieldSerializer<FVulDataPtr>
 			return true;
 		}
 		
-		if (Ctx.Flags.IsEnabled(VulDataPtr_SerializationFlag_Short, Ctx.State.Errors.GetPath()))
+		if (Ctx.Flags.IsEnabled(VulDataPtr_SerializationFlag_Short))
+		{
+			return Ctx.Serialize(Value.GetRowName(), Out);
+		}
+		
+		return Value.VulFieldSet().Serialize(Out, Ctx);
+	}
+
+	static bool Serialize(const FVulDataPtr& Value, FVulFieldWriter& Out, struct FVulFieldSerializationContext& Ctx)
+	{
+		if (!Value.IsSet())
+		{
+			Out.Null();
+			return true;
+		}
+		
+		if (Ctx.Flags.IsEnabled(VulDataPtr_SerializationFlag_Short))
 		{
 			return Ctx.Serialize(Value.GetRowName(), Out);
 		}
@@ -392,7 +408,7 @@ struct TVulFieldSerializer<FVulDataPtr>
 
 	static bool Deserialize(const TSharedPtr<FJsonValue>& Data, FVulDataPtr& Out, struct FVulFieldDeserializationContext& Ctx)
 	{
-		if (Ctx.Flags.IsEnabled(VulDataPtr_SerializationFlag_Short, Ctx.State.Errors.GetPath()))
+		if (Ctx.Flags.IsEnabled(VulDataPtr_SerializationFlag_Short))
 		{
 			Ctx.State.Errors.Add(TEXT("Cannot deserialize TVulDataPtr with SerializeShort enabled"));
 			return false;
@@ -400,6 +416,17 @@ struct TVulFieldSerializer<FVulDataPtr>
 
 		return Out.VulFieldSet().Deserialize(Data, Ctx);
 	}
+
+	static bool Deserialize(FVulFieldReader& In, FVulDataPtr& Out, struct FVulFieldDeserializationContext& Ctx)
+	{
+		if (Ctx.Flags.IsEnabled(VulDataPtr_SerializationFlag_Short))
+		{
+			Ctx.State.Errors.Add(TEXT("Cannot deserialize TVulDataPtr with SerializeShort enabled"));
+			return false;
+		}
+
+		return Out.VulFieldSet().Deserialize(In, Ctx);
+	}
 };
 
 template <typename T>
@@ -414,7 +441,20 @@ struct TVulFieldSerializer<TVulDataPtr<T>>
 	{
 		if constexpr (HasVulFieldSet<T>)
 		{
-			if (Ctx.Flags.IsEnabled(VulDataPtr_SerializationFlag_Data, Ctx.State.Errors.GetPath()))
+			if (Ctx.Flags.IsEnabled(VulDataPtr_SerializationFlag_Data))
+			{
+				return Ctx.Serialize<T>(*Value.Get(), Out);
+			}
+		}
+		
+		return TVulFieldSerializer<FVulDataPtr>::Serialize(Value.Data(), Out, Ctx);
+	}
+
+	static bool Serialize(const TVulDataPtr<T>& Value, FVulFieldWriter& Out, struct FVulFieldSerializationContext& Ctx)
+	{
+		if constexpr (HasVulFieldSet<T>)
+		{
+			if (Ctx.Flags.IsEnabled(VulDataPtr_SerializationFlag_Data))
 			{
 				return Ctx.Serialize<T>(*Value.Get(), Out);
 			}
@@ -427,6 +467,11 @@ struct TVulFieldSerializer<TVulDataPtr<T>>
 	{
 		return TVulFieldSerializer<FVulDataPtr>::Deserialize(Data, Out.Data(), Ctx);
 	}
+
+	static bool Deserialize(FVulFieldReader& In, TVulDataPtr<T>& Out, struct FVulFieldDeserializationContext& Ctx)
+	{
+		return TVulFieldSerializer<FVulDataPtr>::Deserialize(In, Out.Data(), Ctx);
+	}
 };
 
 template <>
@@ -434,7 +479,7 @@ struct TVulFieldMeta<FVulDataPtr>
 {
 	static bool Describe(FVulFieldSerializationContext& Ctx, TSharedPtr<FVulFieldDescription>& Description)
 	{
-		if (Ctx.Flags.IsEnabled(VulDataPtr_SerializationFlag_Short, Ctx.State.Errors.GetPath()))
+		if (Ctx.Flags.IsEnabled(VulDataPtr_SerializationFlag_Short))
 		{
 			Description->String();
 			return true;
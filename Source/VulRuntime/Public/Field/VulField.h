@@ -5,6 +5,10 @@
 #include "VulFieldCommonSerializers.h"
 #include "VulFieldRegistry.h"
 #include "VulFieldSerializationContext.h"
+#include "VulFieldBinaryReader.h"
+#include "VulFieldBinaryWriter.h"
+#include "VulFieldJsonReader.h"
+#include "VulFieldJsonWriter.h"
 #include "UObject/Object.h"
 
 template <typename T>
@@ -42,6 +46,15 @@ struct VULRUNTIME_API FVulField
 		) {
 			return Ctx.Serialize<T>(*static_cast<T*>(Ptr), Out, IdentifierCtx);
 		};
+
+		Out.Stream = [](
+			void* Ptr,
+			FVulFieldWriter& Out,
+			FVulFieldSerializationContext& Ctx,
+			const TOptional<VulRuntime::Field::FPathItem>& IdentifierCtx
+		) {
+			return Ctx.Serialize<T>(*static_cast<T*>(Ptr), Out, IdentifierCtx);
+		};
 		
 		Out.Write = [](
 			const TSharedPtr<FJsonValue>& Value,
@@ -51,10 +64,19 @@ struct VULRUNTIME_API FVulField
 		) {
 			return Ctx.Deserialize<T>(Value, *static_cast<T*>(Ptr), IdentifierCtx);
 		};
+		
+		Out.StreamWrite = [](
+			FVulFieldReader& In,
+			void* Ptr,
+			FVulFieldDeserializationContext& Ctx,
+			const TOptional<VulRuntime::Field::FPathItem>& IdentifierCtx
+		) {
+			return Ctx.Deserialize<T>(In, *static_cast<T*>(Ptr), IdentifierCtx);
+		};
 
-		if (FVulFieldRegistry::Get().Has<T>())
+		if (const auto Registered = FVulFieldRegistry::Get().Find<T>())
 		{
-			Out.TypeId = FVulFieldRegistry::Get().GetType<T>()->TypeId;
+			Out.TypeId = Registered->TypeId;
 		}
 
 		Out.InitDescribeFn<T>();
@@ -81,6 +103,15 @@ struct VULRUNTIME_API FVulField
 		) {
 			return Ctx.Serialize<T>(*reinterpret_cast<T*>(Ptr), Out, IdentifierCtx);
 		};
+
+		Out.Stream = [](
+			void* Ptr,
+			FVulFieldWriter& Out,
+			FVulFieldSerializationContext& Ctx,
+			const TOptional<VulRuntime::Field::FPathItem>& IdentifierCtx
+		) {
+			return Ctx.Serialize<T>(*reinterpret_cast<T*>(Ptr), Out, IdentifierCtx);
+		};
 		
 		Out.Write = [](
 			const TSharedPtr<FJsonValue>& Value,
@@ -92,6 +123,16 @@ struct VULRUNTIME_API FVulField
 			return false;
 		};
 		
+		Out.StreamWrite = [](
+			FVulFieldReader& In,
+			void* Ptr,
+			FVulFieldDeserializationContext& Ctx,
+			const TOptional<VulRuntime::Field::FPathItem>& IdentifierCtx
+		) {
+			Ctx.State.Errors.Add(TEXT("cannot write read-only field"));
+			return false;
+		};
+		
 		Out.InitDescribeFn<T>();
 		
 		return Out;
@@ -114,6 +155,18 @@ struct VULRUNTIME_API FVulField
 		FVulFieldDeserializationContext& Ctx,
 		const TOptional<VulRuntime::Field::FPathItem>& IdentifierCtx = {}
 	);
+
+	/**
+	 * Deserializes this field by pulling its value from In, without building an intermediate
+	 * FJsonValue.
+	 *
+	 * @see FVulFieldDeserializationContext::Deserialize.
+	 */
+	bool Deserialize(
+		FVulFieldReader& In,
+		FVulFieldDeserializationContext& Ctx,
+		const TOptional<VulRuntime::Field::FPathItem>& IdentifierCtx = {}
+	);
 	
 	bool Serialize(TSharedPtr<FJsonValue>& Out) const;
 	bool Serialize(
@@ -122,6 +175,17 @@ struct VULRUNTIME_API FVulField
 		const TOptional<VulRuntime::Field::FPathItem>& IdentifierCtx = {}
 	) const;
 
+	/**
+	 * Streams this field in to Out without building an intermediate FJsonValue.
+	 *
+	 * @see FVulFieldSerializationContext::Serialize.
+	 */
+	bool Serialize(
+		FVulFieldWriter& Out,
+		FVulFieldSerializationContext& Ctx,
+		const TOptional<VulRuntime::Field::FPathItem>& IdentifierCtx = {}
+	) const;
+
 	template <typename CharType = TCHAR>
 	bool DeserializeFromJson(const FString& JsonStr, FVulFieldDeserializationContext& Ctx)
 	{
@@ -143,6 +207,13 @@ struct VULRUNTIME_API FVulField
 		return DeserializeFromJson<CharType>(JsonStr, Ctx);
 	}
 
+	/**
+	 * Deserializes from a JSON string, streaming the input rather than parsing it to an
+	 * FJsonValue first. Much faster & leaner than DeserializeFromJson for large data.
+	 */
+	bool StreamFromJson(const FString& JsonStr, FVulFieldDeserializationContext& Ctx);
+	bool StreamFromJson(const FString& JsonStr);
+
 	template <typename CharType = TCHAR, typename PrintPolicy = TCondensedJsonPrintPolicy<CharType>>
 	bool SerializeToJson(FString& Out, FVulFieldSerializationContext& Ctx) const
 	{
@@ -169,6 +240,22 @@ struct VULRUNTIME_API FVulField
 		return SerializeToJson<CharType, PrintPolicy>(Out, Ctx);
 	}
 
+	/**
+	 * Serializes to a condensed JSON string, streaming the output rather than building an
+	 * FJsonValue first. Much faster & leaner than SerializeToJson for large data.
+	 */
+	bool StreamToJson(FString& Out, FVulFieldSerializationContext& Ctx) const;
+	bool StreamToJson(FString& Out) const;
+
+	/**
+	 * Streams to & from the compact binary format of FVulFieldBinaryWriter, e.g. for save games
+	 * or network payloads.
+	 */
+	bool StreamToBinary(TArray<uint8>& Out, FVulFieldSerializationContext& Ctx) const;
+	bool StreamToBinary(TArray<uint8>& Out) const;
+	bool StreamFromBinary(const TArrayView<const uint8> Data, FVulFieldDeserializationContext& Ctx);
+	bool StreamFromBinary(const TArrayView<const uint8> Data);
+
 	bool IsReadOnly() const;
 
 	bool Describe(
@@ -202,12 +289,26 @@ private:
 		const TOptional<VulRuntime::Field::FPathItem>& IdentifierCtx
 	)> Read;
 	
+	TFunction<bool (
+		void*,
+		FVulFieldWriter&,
+		FVulFieldSerializationContext& Ctx,
+		const TOptional<VulRuntime::Field::FPathItem>& IdentifierCtx
+	)> Stream;
+	
 	TFunction<bool (
 		const TSharedPtr<FJsonValue>&,
 		void*,
 		FVulFieldDeserializationContext& Ctx,
 		const TOptional<VulRuntime::Field::FPathItem>& IdentifierCtx
 	)> Write;
+	
+	TFunction<bool (
+		FVulFieldReader&,
+		void*,
+		FVulFieldDeserializationContext& Ctx,
+		const TOptional<VulRuntime::Field::FPathItem>& IdentifierCtx
+	)> StreamWrite;
 
 	TFunction<bool (
 		FVulFieldSerializationContext& Ctx,
@@ -234,10 +335,20 @@ struct TVulFieldSerializer<T>
 		return Value.VulField().Serialize(Out, Ctx);
 	}
 
+	static bool Serialize(const T& Value, FVulFieldWriter& Out, struct FVulFieldSerializationContext& Ctx)
+	{
+		return Value.VulField().Serialize(Out, Ctx);
+	}
+
 	static bool Deserialize(const TSharedPtr<FJsonValue>& Data, T& Out, struct FVulFieldDeserializationContext& Ctx)
 	{
 		return Out.VulField().Deserialize(Data, Ctx);
 	}
+
+	static bool Deserialize(FVulFieldReader& In, T& Out, struct FVulFieldDeserializationContext& Ctx)
+	{
+		return Out.VulField().Deserialize(In, Ctx);
+	}
 };
 
 template<HasVulField T>
@@ -0,0 +1,63 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "VulFieldBinaryWriter.h"
+#include "VulFieldReader.h"
+
+/**
+ * Reads the binary encoding written by FVulFieldBinaryWriter.
+ *
+ * Arrays & objects are length-prefixed, so skipped values (e.g. unknown properties) are jumped
+ * over without being read, unless they define interned strings that later values may refer to.
+ *
+ * Data is not copied, so must outlive this reader.
+ */
+struct VULRUNTIME_API FVulFieldBinaryReader : FVulFieldReader
+{
+	explicit FVulFieldBinaryReader(const TArrayView<const uint8> InData) : Data(InData) {}
+
+	virtual TOptional<FString> GetError() const override;
+
+protected:
+	virtual EJson Advance() override;
+	virtual FStringView GetKey() const override;
+	virtual FStringView GetString() const override;
+	virtual double GetNumber() const override;
+	virtual bool GetBool() const override;
+	virtual bool SkipContainer() override;
+
+private:
+	TArrayView<const uint8> Data;
+	int64 Pos = 0;
+	bool bReadRoot = false;
+	TOptional<FString> Error;
+
+	/**
+	 * Interned strings in the order they were defined. Views of these stay valid as the array grows.
+	 */
+	TArray<FString> Strings;
+
+	struct FContainer
+	{
+		int64 End;
+		bool bIsObject;
+		bool bHasDefines;
+	};
+
+	TArray<FContainer, TInlineAllocator<16>> Stack;
+
+	bool CurrentBool = false;
+	double CurrentNumber = 0;
+	FStringView CurrentString;
+	FString CurrentStringStorage;
+	FStringView CurrentKey;
+	FString CurrentKeyStorage;
+
+	EJson ReadValue();
+	bool ReadString(const VulRuntime::Field::Binary::ETag Tag, FStringView& Out, FString& Storage);
+	bool ReadVarint(uint64& Out);
+	bool ReadLittleEndian(uint64& Out, const int32 NumBytes);
+	bool ReadHeader();
+	bool ReadBytes(void* Out, const int64 Num);
+	EJson Fail(const FString& Message);
+};
@@ -0,0 +1,133 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "VulFieldWriter.h"
+
+namespace VulRuntime::Field::Binary
+{
+	/**
+	 * Binary data starts with these 4 bytes, "VFLD", then a version byte, then the root value.
+	 */
+	constexpr uint32 Magic = 0x444C4656;
+
+	/**
+	 * Bumped on any change to the format, so data from other versions is rejected rather than misread.
+	 */
+	constexpr uint8 Version = 1;
+
+	/**
+	 * The leading byte of each value in the binary format.
+	 *
+	 * Integers are zig-zag varints, strings are a varint UTF-8 byte length then their bytes and
+	 * arrays & objects are a 4 byte length of their contents, then the contents. Object contents
+	 * are a string key before each value. Fixed-size values, i.e. lengths and the IEEE 754 bits of
+	 * floats & doubles, are little-endian.
+	 */
+	enum class ETag : uint8
+	{
+		Null,
+		False,
+		True,
+		Int,
+		Float,
+		Double,
+		String,
+		/**
+		 * A string that is added to the intern table, so later occurrences can be a StringRef.
+		 */
+		StringDefine,
+		/**
+		 * A varint index in to the intern table, in order of StringDefines.
+		 */
+		StringRef,
+		Array,
+		Object,
+		/**
+		 * As Array & Object, but they contain StringDefines, so cannot be skipped over without
+		 * being read.
+		 */
+		ArrayWithDefines,
+		ObjectWithDefines,
+	};
+
+	/**
+	 * String values up to this many characters are interned, as these are likely to be refs or
+	 * enum values that repeat. Longer strings are written in full each time. Keys are always interned.
+	 */
+	constexpr int32 MaxInternedLength = 64;
+}
+
+/**
+ * Streams a compact binary encoding straight in to a byte array, for save games, replays and
+ * network payloads where JSON is too large or slow to read.
+ *
+ * Property names and short strings are written once then referenced by index, and numbers are
+ * stored as varints or floats where they fit. Read with FVulFieldBinaryReader.
+ *
+ * Floating points are rounded to the requested precision as text formats would, so the binary
+ * and JSON forms of the same data deserialize to the same values.
+ */
+struct VULRUNTIME_API FVulFieldBinaryWriter : FVulFieldWriter
+{
+	/**
+	 * Appends to InOut, starting with the format's magic and version.
+	 */
+	explicit FVulFieldBinaryWriter(TArray<uint8>& InOut);
+
+protected:
+	virtual void WriteNull() override;
+	virtual void WriteBool(const bool Value) override;
+	virtual void WriteInt(const int64 Value) override;
+	virtual void WriteDouble(const double Value, const int32 Precision) override;
+	virtual void WriteRawNumber(const FString& Value) override;
+	virtual void WriteString(const FString& Value) override;
+	virtual void WriteBeginArray() override;
+	virtual void WriteEndArray() override;
+	virtual void WriteBeginObject() override;
+	virtual void WriteEndObject() override;
+	virtual void WriteKey(const FString& Name) override;
+	virtual void WriteSeparator() override;
+	virtual int64 GetPosition() const override;
+	virtual void Truncate(const int64 Position) override;
+
+private:
+	TArray<uint8>& Out;
+
+	/**
+	 * Interned strings must match exactly, unlike the default case-insensitive FString keys.
+	 */
+	struct FInternKeyFuncs : TDefaultMapKeyFuncs<FString, int32, false>
+	{
+		static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+		static uint32 GetKeyHash(const FString& Key) { return FCrc::StrCrc32(*Key); }
+	};
+
+	TMap<FString, int32, FDefaultSetAllocator, FInternKeyFuncs> Interned;
+
+	struct FDefinition
+	{
+		FString Value;
+		/**
+		 * Where the string was defined, so it's forgotten if rewound past.
+		 */
+		int64 Position;
+	};
+
+	TArray<FDefinition> Definitions;
+
+	struct FContainer
+	{
+		int64 Start;
+		int32 InternedNum;
+	};
+
+	TArray<FContainer, TInlineAllocator<16>> Containers;
+
+	void WriteTag(const VulRuntime::Field::Binary::ETag Tag);
+	void WriteVarint(uint64 Value);
+	void WriteLittleEndian(const uint64 Value, const int32 NumBytes);
+	void WriteUtf8(const FString& Value);
+	void WriteStringToken(const FString& Value, const bool bAlwaysIntern);
+	void BeginContainer(const VulRuntime::Field::Binary::ETag Tag);
+	void EndContainer(const VulRuntime::Field::Binary::ETag WithDefines);
+};
@@ -11,6 +11,12 @@ struct TVulFieldSerializer<bool>
 		Out = MakeShared<FJsonValueBoolean>(Value);
 		return true;
 	}
+
+	static bool Serialize(const bool& Value, FVulFieldWriter& Out, FVulFieldSerializationContext& Ctx)
+	{
+		Out.Bool(Value);
+		return true;
+	}
 	
 	static bool Deserialize(const TSharedPtr<FJsonValue>& Data, bool& Out, FVulFieldDeserializationContext& Ctx)
 	{
@@ -21,6 +27,16 @@ struct TVulFieldSerializer<bool>
 
 		return Ctx.State.Errors.AddIfNot(Data->TryGetBool(Out), TEXT("serialized data is not a bool"));
 	}
+
+	static bool Deserialize(FVulFieldReader& In, bool& Out, FVulFieldDeserializationContext& Ctx)
+	{
+		if (!Ctx.State.Errors.RequireJsonType(In, EJson::Boolean))
+		{
+			return false;
+		}
+
+		return In.Bool(Out);
+	}
 };
 
 template<>
@@ -50,6 +66,22 @@ struct TVulFieldSerializer<T>
 		}
 		return true;
 	}
+
+	static bool Serialize(const T& Value, FVulFieldWriter& Out, FVulFieldSerializationContext& Ctx)
+	{
+		if constexpr (std::is_floating_point_v<T>)
+		{
+			Out.Double(Value, Ctx.DefaultPrecision);
+		} else if constexpr (std::is_unsigned_v<T> && sizeof(T) >= sizeof(int64))
+		{
+			// May not fit in an int64, so written as the FJsonValueNumber double would be.
+			Out.Double(static_cast<double>(Value));
+		} else
+		{
+			Out.Int(static_cast<int64>(Value));
+		}
+		return true;
+	}
 	
 	static bool Deserialize(const TSharedPtr<FJsonValue>& Data, T& Out, FVulFieldDeserializationContext& Ctx)
 	{
@@ -60,6 +92,20 @@ struct TVulFieldSerializer<T>
 
 		return Ctx.State.Errors.AddIfNot(Data->TryGetNumber(Out), TEXT("serialized data is not a number"));
 	}
+
+	static bool Deserialize(FVulFieldReader& In, T& Out, FVulFieldDeserializationContext& Ctx)
+	{
+		if (!Ctx.State.Errors.RequireJsonType(In, EJson::Number))
+		{
+			return false;
+		}
+
+		double Number;
+		In.Number(Number);
+
+		// Converted as FJsonValue does, so both paths agree on range & rounding.
+		return Ctx.State.Errors.AddIfNot(FJsonValueNumber(Number).TryGetNumber(Out), TEXT("serialized data is not a number"));
+	}
 };
 
 template<IsNumeric T>
@@ -80,6 +126,12 @@ struct TVulFieldSerializer<FString>
 		Out = MakeShared<FJsonValueString>(Value);
 		return true;
 	}
+
+	static bool Serialize(const FString& Value, FVulFieldWriter& Out, FVulFieldSerializationContext& Ctx)
+	{
+		Out.String(Value);
+		return true;
+	}
 	
 	static bool Deserialize(const TSharedPtr<FJsonValue>& Data, FString& Out, FVulFieldDeserializationContext& Ctx)
 	{
@@ -90,6 +142,16 @@ struct TVulFieldSerializer<FString>
 
 		return Ctx.State.Errors.AddIfNot(Data->TryGetString(Out), TEXT("serialized data is not a string"));
 	}
+
+	static bool Deserialize(FVulFieldReader& In, FString& Out, FVulFieldDeserializationContext& Ctx)
+	{
+		if (!Ctx.State.Errors.RequireJsonType(In, EJson::String))
+		{
+			return false;
+		}
+
+		return In.String(Out);
+	}
 };
 
 template<>
@@ -110,6 +172,12 @@ struct TVulFieldSerializer<FName>
 		Out = MakeShared<FJsonValueString>(Value.ToString());
 		return true;
 	}
+
+	static bool Serialize(const FName& Value, FVulFieldWriter& Out, FVulFieldSerializationContext& Ctx)
+	{
+		Out.String(Value.ToString());
+		return true;
+	}
 	
 	static bool Deserialize(const TSharedPtr<FJsonValue>& Data, FName& Out, FVulFieldDeserializationContext& Ctx)
 	{
@@ -121,6 +189,17 @@ struct TVulFieldSerializer<FName>
 		Out = FName(Data->AsString());
 		return true;
 	}
+
+	static bool Deserialize(FVulFieldReader& In, FName& Out, FVulFieldDeserializationContext& Ctx)
+	{
+		if (!Ctx.State.Errors.RequireJsonType(In, EJson::String))
+		{
+			return false;
+		}
+
+		Out = FName(In.StringView());
+		return In.Skip();
+	}
 };
 
 template<>
@@ -141,6 +220,12 @@ struct TVulFieldSerializer<FText>
 		Out = MakeShared<FJsonValueString>(Value.ToString());
 		return true;
 	}
+
+	static bool Serialize(const FText& Value, FVulFieldWriter& Out, FVulFieldSerializationContext& Ctx)
+	{
+		Out.String(Value.ToString());
+		return true;
+	}
 	
 	static bool Deserialize(const TSharedPtr<FJsonValue>& Data, FText& Out, FVulFieldDeserializationContext& Ctx)
 	{
@@ -152,6 +237,19 @@ struct TVulFieldSerializer<FText>
 		Out = FText::FromString(Data->AsString());
 		return true;
 	}
+
+	static bool Deserialize(FVulFieldReader& In, FText& Out, FVulFieldDeserializationContext& Ctx)
+	{
+		if (!Ctx.State.Errors.RequireJsonType(In, EJson::String))
+		{
+			return false;
+		}
+
+		FString String;
+		In.String(String);
+		Out = FText::FromString(MoveTemp(String));
+		return true;
+	}
 };
 
 template<>
@@ -187,6 +285,24 @@ struct TVulFieldSerializer<TArray<V>>
 		
 		return true;
 	}
+
+	static bool Serialize(const TArray<V>& Value, FVulFieldWriter& Out, FVulFieldSerializationContext& Ctx)
+	{
+		Out.BeginArray();
+		
+		int I = 0;
+		for (const auto& Item : Value)
+		{
+			if (!Ctx.Serialize<V>(Item, Out, VulRuntime::Field::FPathItem(TInPlaceType<int>(), I++)))
+			{
+				return false;
+			}
+		}
+
+		Out.EndArray();
+		
+		return true;
+	}
 	
 	static bool Deserialize(const TSharedPtr<FJsonValue>& Data, TArray<V>& Out, FVulFieldDeserializationContext& Ctx)
 	{
@@ -211,6 +327,31 @@ struct TVulFieldSerializer<TArray<V>>
 		
 		return true;
 	}
+
+	static bool Deserialize(FVulFieldReader& In, TArray<V>& Out, FVulFieldDeserializationContext& Ctx)
+	{
+		if (!Ctx.State.Errors.RequireJsonType(In, EJson::Array))
+		{
+			return false;
+		}
+		
+		Out.Reset();
+		In.BeginArray();
+
+		int I = 0;
+		while (In.Peek() != EJson::None)
+		{
+			V Value;
+			if (!Ctx.Deserialize<V>(In, Value, VulRuntime::Field::FPathItem(TInPlaceType<int>(), I++)))
+			{
+				return false;
+			}
+
+			Out.Add(MoveTemp(Value));
+		}
+		
+		return Ctx.State.Errors.AddIfNot(In.EndArray(), TEXT("cannot read array: %s"), *In.DescribeError());
+	}
 };
 
 template<typename V>
@@ -263,6 +404,47 @@ struct TVulFieldSerializer<TMap<K, V>>
 
 		return true;
 	}
+
+	static bool Serialize(const TMap<K, V>& Value, FVulFieldWriter& Out, FVulFieldSerializationContext& Ctx)
+	{
+		Out.BeginObject();
+		
+		for (const auto& Entry : Value)
+		{
+			FString ItemKey;
+			
+			if constexpr (std::is_same_v<K, FString>)
+			{
+				ItemKey = Entry.Key;
+			} else
+			{
+				// Keys must serialize to strings, which is checked via their FJsonValue.
+				TSharedPtr<FJsonValue> KeyJson;
+				if (!Ctx.Serialize<K>(Entry.Key, KeyJson, VulRuntime::Field::FPathItem(TInPlaceType<FString>(), "__key__")))
+				{
+					return false;
+				}
+
+				if (!Ctx.State.Errors.RequireJsonType(KeyJson, EJson::String))
+				{
+					return false;
+				}
+
+				ItemKey = KeyJson->AsString();
+			}
+
+			Out.Key(ItemKey);
+			
+			if (!Ctx.Serialize<V>(Entry.Value, Out, VulRuntime::Field::FPathItem(TInPlaceType<FString>(), ItemKey)))
+			{
+				return false;
+			}
+		}
+
+		Out.EndObject();
+
+		return true;
+	}
 	
 	static bool Deserialize(const TSharedPtr<FJsonValue>& Data, TMap<K, V>& Out, FVulFieldDeserializationContext& Ctx)
 	{
@@ -293,6 +475,40 @@ struct TVulFieldSerializer<TMap<K, V>>
 		
 		return true;
 	}
+
+	static bool Deserialize(FVulFieldReader& In, TMap<K, V>& Out, FVulFieldDeserializationContext& Ctx)
+	{
+		if (!Ctx.State.Errors.RequireJsonType(In, EJson::Object))
+		{
+			return false;
+		}
+
+		Out.Reset();
+		In.BeginObject();
+
+		while (In.Peek() != EJson::None)
+		{
+			K KeyToAdd;
+			
+			if constexpr (std::is_same_v<K, FString>)
+			{
+				KeyToAdd = FString(In.Key());
+			} else if (!Ctx.Deserialize<K>(MakeShared<FJsonValueString>(FString(In.Key())), KeyToAdd))
+			{
+				return false;
+			}
+			
+			V ValueToAdd;
+			if (!Ctx.Deserialize<V>(In, ValueToAdd))
+			{
+				return false;
+			}
+
+			Out.Add(MoveTemp(KeyToAdd), MoveTemp(ValueToAdd));
+		}
+		
+		return Ctx.State.Errors.AddIfNot(In.EndObject(), TEXT("cannot read object: %s"), *In.DescribeError());
+	}
 };
 
 template <typename K, typename V>
@@ -330,6 +546,17 @@ struct TVulFieldSerializer<TOptional<T>>
 		return Ctx.Serialize<T>(Value.GetValue(), Out);
 	}
 
+	static bool Serialize(const TOptional<T>& Value, FVulFieldWriter& Out, FVulFieldSerializationContext& Ctx)
+	{
+		if (!Value.IsSet())
+		{
+			Out.Null();
+			return true;
+		}
+
+		return Ctx.Serialize<T>(Value.GetValue(), Out);
+	}
+
 	static bool Deserialize(const TSharedPtr<FJsonValue>& Data, TOptional<T>& Out, FVulFieldDeserializationContext& Ctx)
 	{
 		if (Data->Type == EJson::Null)
@@ -347,6 +574,24 @@ struct TVulFieldSerializer<TOptional<T>>
 		Out = Inner;
 		return true;
 	}
+
+	static bool Deserialize(FVulFieldReader& In, TOptional<T>& Out, FVulFieldDeserializationContext& Ctx)
+	{
+		if (In.Null())
+		{
+			Out = TOptional<T>{};
+			return true;
+		}
+
+		T Inner;
+		if (!Ctx.Deserialize<T>(In, Inner))
+		{
+			return false;
+		}
+
+		Out = MoveTemp(Inner);
+		return true;
+	}
 };
 
 template <typename T>
@@ -379,6 +624,17 @@ struct TVulFieldSerializer<TSharedPtr<T>>
 		return Ctx.Serialize<T>(*Value.Get(), Out);
 	}
 
+	static bool Serialize(const TSharedPtr<T>& Value, FVulFieldWriter& Out, FVulFieldSerializationContext& Ctx)
+	{
+		if (!Value.IsValid())
+		{
+			Out.Null();
+			return true;
+		}
+		
+		return Ctx.Serialize<T>(*Value.Get(), Out);
+	}
+
 	static bool Deserialize(const TSharedPtr<FJsonValue>& Data, TSharedPtr<T>& Out, FVulFieldDeserializationContext& Ctx)
 	{
 		if (Data->Type == EJson::Null)
@@ -395,6 +651,18 @@ struct TVulFieldSerializer<TSharedPtr<T>>
 
 		return true;
 	}
+
+	static bool Deserialize(FVulFieldReader& In, TSharedPtr<T>& Out, FVulFieldDeserializationContext& Ctx)
+	{
+		if (In.Null())
+		{
+			Out = nullptr;
+			return true;
+		}
+
+		Out = MakeShared<T>();
+		return Ctx.Deserialize<T>(In, *Out.Get());
+	}
 };
 
 template <typename T>
@@ -420,6 +688,17 @@ struct TVulFieldSerializer<TUniquePtr<T>>
 		return Ctx.Serialize<T>(*Value.Get(), Out);
 	}
 
+	static bool Serialize(const TUniquePtr<T>& Value, FVulFieldWriter& Out, FVulFieldSerializationContext& Ctx)
+	{
+		if (!Value.IsValid())
+		{
+			Out.Null();
+			return true;
+		}
+		
+		return Ctx.Serialize<T>(*Value.Get(), Out);
+	}
+
 	static bool Deserialize(const TSharedPtr<FJsonValue>& Data, TUniquePtr<T>& Out, FVulFieldDeserializationContext& Ctx)
 	{
 		static_assert(std::is_move_constructible<T>::value, "T must be move-constructible for TUniquePtr Vul field deserialization");
@@ -438,6 +717,18 @@ struct TVulFieldSerializer<TUniquePtr<T>>
 
 		return true;
 	}
+
+	static bool Deserialize(FVulFieldReader& In, TUniquePtr<T>& Out, FVulFieldDeserializationContext& Ctx)
+	{
+		if (In.Null())
+		{
+			Out = nullptr;
+			return true;
+		}
+
+		Out = MakeUnique<T>();
+		return Ctx.Deserialize<T>(In, *Out.Get());
+	}
 };
 
 template <typename T>
@@ -463,6 +754,17 @@ struct TVulFieldSerializer<TWeakObjectPtr<T>>
 		return Ctx.Serialize<T>(*Value.Get(), Out);
 	}
 
+	static bool Serialize(const TWeakObjectPtr<T>& Value, FVulFieldWriter& Out, FVulFieldSerializationContext& Ctx)
+	{
+		if (!Value.IsValid())
+		{
+			Out.Null();
+			return true;
+		}
+		
+		return Ctx.Serialize<T>(*Value.Get(), Out);
+	}
+
 	static bool Deserialize(const TSharedPtr<FJsonValue>& Data, TWeakObjectPtr<T>& Out, FVulFieldDeserializationContext& Ctx)
 	{
 		if (Data->Type == EJson::Null)
@@ -504,6 +806,17 @@ struct TVulFieldSerializer<T*>
 		return Ctx.Serialize<T>(*Value, Out);
 	}
 
+	static bool Serialize(const T* const& Value, FVulFieldWriter& Out, FVulFieldSerializationContext& Ctx)
+	{
+		if (Value == nullptr)
+		{
+			Out.Null();
+			return true;
+		}
+		
+		return Ctx.Serialize<T>(*Value, Out);
+	}
+
 	static bool Deserialize(const TSharedPtr<FJsonValue>& Data, T*& Out, FVulFieldDeserializationContext& Ctx)
 	{
 		if (Data->Type == EJson::Null)
@@ -520,6 +833,18 @@ struct TVulFieldSerializer<T*>
 
 		return true;
 	}
+
+	static bool Deserialize(FVulFieldReader& In, T*& Out, FVulFieldDeserializationContext& Ctx)
+	{
+		if (In.Null())
+		{
+			Out = nullptr;
+			return true;
+		}
+
+		Out = new T;
+		return Ctx.Deserialize<T>(In, *Out);
+	}
 };
 
 template <typename T>
@@ -539,6 +864,11 @@ struct TVulFieldSerializer<TSharedRef<T>>
 		return Ctx.Serialize<T>(Value.Get(), Out);
 	}
 
+	static bool Serialize(const TSharedRef<T>& Value, FVulFieldWriter& Out, FVulFieldSerializationContext& Ctx)
+	{
+		return Ctx.Serialize<T>(Value.Get(), Out);
+	}
+
 	static bool Deserialize(const TSharedPtr<FJsonValue>& Data, TSharedRef<T>& Out, FVulFieldDeserializationContext& Ctx)
 	{
 		TSharedPtr<T> Inner = MakeShared<T>();
@@ -551,6 +881,19 @@ struct TVulFieldSerializer<TSharedRef<T>>
 
 		return true;
 	}
+
+	static bool Deserialize(FVulFieldReader& In, TSharedRef<T>& Out, FVulFieldDeserializationContext& Ctx)
+	{
+		TSharedRef<T> Inner = MakeShared<T>();
+		if (!Ctx.Deserialize<T>(In, Inner.Get()))
+		{
+			return false;
+		}
+
+		Out = Inner;
+
+		return true;
+	}
 };
 
 template <HasEnumToString T>
@@ -562,6 +905,12 @@ struct TVulFieldSerializer<T>
 		return true;
 	}
 
+	static bool Serialize(const T& Value, FVulFieldWriter& Out, FVulFieldSerializationContext& Ctx)
+	{
+		Out.String(EnumToString(Value));
+		return true;
+	}
+
 	static bool Deserialize(const TSharedPtr<FJsonValue>& Data, T& Out, FVulFieldDeserializationContext& Ctx)
 	{
 		if (!Ctx.State.Errors.RequireJsonType(Data, EJson::String))
@@ -577,6 +926,25 @@ struct TVulFieldSerializer<T>
 		
 		return true;
 	}
+
+	static bool Deserialize(FVulFieldReader& In, T& Out, FVulFieldDeserializationContext& Ctx)
+	{
+		if (!Ctx.State.Errors.RequireJsonType(In, EJson::String))
+		{
+			return false;
+		}
+
+		FString String;
+		In.String(String);
+
+		if (!VulRuntime::Enum::FromString(String, Out))
+		{
+			Ctx.State.Errors.Add(TEXT("cannot interpret enum value \"%s\""), *String);
+			return false;
+		}
+		
+		return true;
+	}
 };
 
 template <HasEnumToString T>
@@ -616,6 +984,24 @@ struct TVulFieldSerializer<TPair<T,S>>
 		Out = MakeShared<FJsonValueArray>(Entries);
 		return true;
 	}
+
+	static bool Serialize(const TPair<T,S>& Value, FVulFieldWriter& Out, FVulFieldSerializationContext& Ctx)
+	{
+		Out.BeginArray();
+
+		if (!Ctx.Serialize(Value.Key, Out, VulRuntime::Field::FPathItem(TInPlaceType<int>(), 0)))
+		{
+			return false;
+		}
+
+		if (!Ctx.Serialize(Value.Value, Out, VulRuntime::Field::FPathItem(TInPlaceType<int>(), 1)))
+		{
+			return false;
+		}
+
+		Out.EndArray();
+		return true;
+	}
 	
 	static bool Deserialize(const TSharedPtr<FJsonValue>& Data, TPair<T,S>& Out, FVulFieldDeserializationContext& Ctx)
 	{
@@ -644,6 +1030,35 @@ struct TVulFieldSerializer<TPair<T,S>>
 
 		return true;
 	}
+
+	static bool Deserialize(FVulFieldReader& In, TPair<T,S>& Out, FVulFieldDeserializationContext& Ctx)
+	{
+		if (!Ctx.State.Errors.RequireJsonType(In, EJson::Array))
+		{
+			return false;
+		}
+		
+		Out = TPair<T,S>();
+		In.BeginArray();
+
+		if (!Ctx.Deserialize(In, Out.Key, VulRuntime::Field::FPathItem(TInPlaceType<int>(), 0)))
+		{
+			return false;
+		}
+
+		if (!Ctx.Deserialize(In, Out.Value, VulRuntime::Field::FPathItem(TInPlaceType<int>(), 1)))
+		{
+			return false;
+		}
+
+		if (In.Peek() != EJson::None)
+		{
+			Ctx.State.Errors.Add(TEXT("TPair expects an array of size 2, but has more entries"));
+			return false;
+		}
+
+		return Ctx.State.Errors.AddIfNot(In.EndArray(), TEXT("cannot read array: %s"), *In.DescribeError());
+	}
 };
 
 template <typename T, typename S>
@@ -686,6 +1101,18 @@ struct TVulFieldSerializer<FGuid>
 		Out = MakeShared<FJsonValueString>(Value.ToString());
 		return true;
 	}
+
+	static bool Serialize(const FGuid& Value, FVulFieldWriter& Out, FVulFieldSerializationContext& Ctx)
+	{
+		if (!Value.IsValid())
+		{
+			Out.Null();
+			return true;
+		}
+
+		Out.String(Value.ToString());
+		return true;
+	}
 	
 	static bool Deserialize(const TSharedPtr<FJsonValue>& Data, FGuid& Out, FVulFieldDeserializationContext& Ctx)
 	{
@@ -709,6 +1136,32 @@ struct TVulFieldSerializer<FGuid>
 
 		return true;
 	}
+
+	static bool Deserialize(FVulFieldReader& In, FGuid& Out, FVulFieldDeserializationContext& Ctx)
+	{
+		Out = FGuid();
+		
+		if (In.Null())
+		{
+			return true;
+		}
+
+		if (!Ctx.State.Errors.RequireJsonType(In, EJson::String))
+		{
+			return false;
+		}
+
+		FString String;
+		In.String(String);
+
+		if (!FGuid::Parse(String, Out))
+		{
+			Ctx.State.Errors.Add(TEXT("Cannot parse invalid FGuid string `%s`"), *String);
+			return false;
+		}
+
+		return true;
+	}
 };
 
 template <>
@@ -0,0 +1,27 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "VulFieldReader.h"
+
+/**
+ * Streams JSON text token by token via a TJsonReader, never building an FJsonValue tree.
+ *
+ * Reading from an FArchive (e.g. a file reader) keeps memory bounded for large inputs.
+ */
+struct VULRUNTIME_API FVulFieldJsonReader : FVulFieldReader
+{
+	explicit FVulFieldJsonReader(const FString& Json);
+	explicit FVulFieldJsonReader(FArchive* const Archive);
+
+	virtual TOptional<FString> GetError() const override;
+
+protected:
+	virtual EJson Advance() override;
+	virtual FStringView GetKey() const override;
+	virtual FStringView GetString() const override;
+	virtual double GetNumber() const override;
+	virtual bool GetBool() const override;
+
+private:
+	TSharedRef<TJsonReader<TCHAR>> Reader;
+};
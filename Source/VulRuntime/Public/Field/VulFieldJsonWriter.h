@@ -0,0 +1,34 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "VulFieldWriter.h"
+
+/**
+ * Streams condensed JSON text straight in to a string.
+ *
+ * Produces the same JSON as serializing to an FJsonValue and printing it with
+ * TCondensedJsonPrintPolicy, without building the FJsonValue tree.
+ */
+struct VULRUNTIME_API FVulFieldJsonWriter : FVulFieldWriter
+{
+	explicit FVulFieldJsonWriter(FString& InOut) : Out(InOut) {}
+
+protected:
+	virtual void WriteNull() override;
+	virtual void WriteBool(const bool Value) override;
+	virtual void WriteInt(const int64 Value) override;
+	virtual void WriteDouble(const double Value, const int32 Precision) override;
+	virtual void WriteRawNumber(const FString& Value) override;
+	virtual void WriteString(const FString& Value) override;
+	virtual void WriteBeginArray() override;
+	virtual void WriteEndArray() override;
+	virtual void WriteBeginObject() override;
+	virtual void WriteEndObject() override;
+	virtual void WriteKey(const FString& Name) override;
+	virtual void WriteSeparator() override;
+	virtual int64 GetPosition() const override;
+	virtual void Truncate(const int64 Position) override;
+
+private:
+	FString& Out;
+};
@@ -0,0 +1,107 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * A source for streaming FVulField deserialization, the counterpart to FVulFieldWriter.
+ *
+ * Serializers pull values from here in order, instead of walking an FJsonValue tree, so input
+ * can be consumed without building one. Each read consumes the current value and moves on to
+ * the next; Peek reports the current value's type without consuming it, or EJson::None when
+ * the current array or object has no more values.
+ *
+ * Reading an object:
+ *
+ *   In.BeginObject();
+ *   while (In.Peek() != EJson::None)
+ *   {
+ *       // In.Key() is the name of the current property; read or Skip its value.
+ *   }
+ *   In.EndObject();
+ *
+ * Input formats implement the protected functions; @see FVulFieldJsonReader.
+ */
+struct VULRUNTIME_API FVulFieldReader
+{
+	virtual ~FVulFieldReader() = default;
+
+	/**
+	 * The type of the current value, or EJson::None at the end of the current container, the
+	 * end of input or on error.
+	 */
+	EJson Peek();
+
+	/**
+	 * The property name of the current value, if in an object. Only valid until the next read.
+	 */
+	FStringView Key();
+
+	/*
+	 * Each of these consumes the current value, returning false if it is not of that type.
+	 */
+	bool Null();
+	bool Bool(bool& Out);
+	bool Number(double& Out);
+	bool String(FString& Out);
+
+	/**
+	 * The current string value, without consuming or copying it. Only valid until the next read.
+	 */
+	FStringView StringView();
+
+	bool BeginArray();
+	bool EndArray();
+	bool BeginObject();
+	bool EndObject();
+
+	/**
+	 * Consumes the current value, including everything within it if an array or object.
+	 */
+	bool Skip();
+
+	/**
+	 * Consumes the current value in to an FJsonValue tree, for serializers that have no streaming
+	 * implementation.
+	 */
+	bool Json(TSharedPtr<FJsonValue>& Out);
+
+	/**
+	 * Set if the input could not be read, e.g. it is malformed.
+	 */
+	virtual TOptional<FString> GetError() const = 0;
+
+	/**
+	 * The error, if any, else a description of why a read may have failed, for reporting.
+	 */
+	FString DescribeError() const;
+
+protected:
+	/**
+	 * Moves to the next token, returning its type. Arrays and objects are a start token of their
+	 * type, their values, then an end token which, like the end of input, is EJson::None.
+	 */
+	virtual EJson Advance() = 0;
+
+	/**
+	 * Accessors for the current token; only called when it's of the relevant type.
+	 */
+	virtual FStringView GetKey() const = 0;
+	virtual FStringView GetString() const = 0;
+	virtual double GetNumber() const = 0;
+	virtual bool GetBool() const = 0;
+
+	/**
+	 * Called when skipping an array or object that has just been advanced to. Formats that know
+	 * where it ends can move past it without reading its values, so the next Advance is the token
+	 * after it, returning true. Otherwise, return false and its tokens are read through.
+	 */
+	virtual bool SkipContainer() { return false; }
+
+private:
+	EJson Current = EJson::None;
+	bool bStarted = false;
+	int32 Depth = 0;
+
+	void Next();
+	bool End();
+};
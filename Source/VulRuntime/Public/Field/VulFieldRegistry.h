@@ -52,17 +52,43 @@ struct VULRUNTIME_API FVulFieldRegistry
 
 	static FVulFieldRegistry& Get();
 
+	/**
+	 * The registered entry for T, or nullptr if T is not registered.
+	 *
+	 * Prefer this over GetType in hot paths as it does not copy the entry.
+	 */
+	template <typename T>
+	const FEntry* Find() const
+	{
+		return Entries.Find(VulRuntime::Field::TypeKey<T>());
+	}
+
+	const FEntry* Find(const FString& TypeId) const
+	{
+		return Find(VulRuntime::Field::TypeKey(TypeId));
+	}
+
+	const FEntry* Find(const uint64 TypeKey) const
+	{
+		return Entries.Find(TypeKey);
+	}
+
 	template <typename T>
 	TOptional<FEntry> GetType() const
 	{
-		return GetType(VulRuntime::Field::TypeId<T>());
+		if (const auto Entry = Find<T>())
+		{
+			return *Entry;
+		}
+
+		return {};
 	}
 	
 	TOptional<FEntry> GetType(const FString& TypeId) const
 	{
-		if (Entries.Contains(TypeId))
+		if (const auto Entry = Find(TypeId))
 		{
-			return Entries[TypeId];
+			return *Entry;
 		}
 
 		return {};
@@ -71,12 +97,12 @@ struct VULRUNTIME_API FVulFieldRegistry
 	template <typename T>
 	bool Has() const
 	{
-		return Has(VulRuntime::Field::TypeId<T>());
+		return Find<T>() != nullptr;
 	}
 	
 	bool Has(const FString& TypeId) const
 	{
-		return GetType(TypeId).IsSet();
+		return Find(TypeId) != nullptr;
 	}
 
 	TArray<FEntry> GetSubtypes(const FString& TypeId) const;
@@ -85,13 +111,13 @@ struct VULRUNTIME_API FVulFieldRegistry
 	template <typename T>
 	FEntry& Register(const FString& TypeName)
 	{
-		if (Entries.Contains(VulRuntime::Field::TypeId<T>()))
+		if (const auto Existing = Entries.Find(VulRuntime::Field::TypeKey<T>()))
 		{
 			// Cannot override for now. Works around a VUL_RUN_ONCE macro not actually running once.
-			return Entries[VulRuntime::Field::TypeId<T>()];
+			return *Existing;
 		}
 		
-		return Entries.Add(VulRuntime::Field::TypeId<T>(), FEntry{
+		return Entries.Add(VulRuntime::Field::TypeKey<T>(), FEntry{
 			.Name = TypeName,
 			.TypeId = VulRuntime::Field::TypeId<T>(),
 			.DescribeFn = [](FVulFieldSerializationContext& Ctx, TSharedPtr<FVulFieldDescription>& Description)
@@ -110,11 +136,14 @@ struct VULRUNTIME_API FVulFieldRegistry
 			*VulRuntime::Field::TypeInfo<T>()
 		);
 
-		return Entries[VulRuntime::Field::TypeId<T>()];
+		return Entries[VulRuntime::Field::TypeKey<T>()];
 	}
 
 private:
-	TMap<FString, FEntry> Entries;
+	/**
+	 * Keyed by VulRuntime::Field::TypeKey.
+	 */
+	TMap<uint64, FEntry> Entries;
 };
 
 /**
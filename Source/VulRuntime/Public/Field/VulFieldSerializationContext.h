@@ -5,7 +5,9 @@
 #include "VulFieldRefResolver.h"
 #include "VulFieldSerializationOptions.h"
 #include "VulFieldSerializer.h"
+#include "VulFieldReader.h"
 #include "VulFieldUtil.h"
+#include "VulFieldWriter.h"
 #include "UObject/Object.h"
 
 struct VULRUNTIME_API FVulFieldSerializationErrors
@@ -50,6 +52,11 @@ struct VULRUNTIME_API FVulFieldSerializationErrors
 	 */
 	bool RequireJsonType(const TSharedPtr<FJsonValue>& Value, const EJson Type);
 	
+	/**
+	 * As above, checking the current value of a streaming reader.
+	 */
+	bool RequireJsonType(FVulFieldReader& In, const EJson Type);
+	
 	bool RequireJsonProperty(
 		const TSharedPtr<FJsonValue>& Value,
 		const FString& Property,
@@ -66,7 +73,7 @@ struct VULRUNTIME_API FVulFieldSerializationErrors
 
 	TArray<FString> Errors;
 
-	VulRuntime::Field::FPath GetPath() const;
+	const VulRuntime::Field::FPath& GetPath() const;
 
 private:
 	void Push(const VulRuntime::Field::FPathItem& Identifier);
@@ -116,6 +123,24 @@ struct VULRUNTIME_API FVulFieldSerializationState
 template <typename T>
 concept SerializerHasSetup = requires { TVulFieldSerializer<T>::Setup(); };
 
+/**
+ * Serializers can optionally stream their output by implementing a Serialize overload taking
+ * a FVulFieldWriter in place of the FJsonValue.
+ */
+template <typename T>
+concept SerializerHasStream = requires(const T& Value, FVulFieldWriter& Out, FVulFieldSerializationContext& Ctx) {
+	{ TVulFieldSerializer<T>::Serialize(Value, Out, Ctx) } -> std::same_as<bool>;
+};
+
+/**
+ * Likewise, serializers can optionally stream their input by implementing a Deserialize overload
+ * taking a FVulFieldReader in place of the FJsonValue.
+ */
+template <typename T>
+concept DeserializerHasStream = requires(FVulFieldReader& In, T& Out, FVulFieldDeserializationContext& Ctx) {
+	{ TVulFieldSerializer<T>::Deserialize(In, Out, Ctx) } -> std::same_as<bool>;
+};
+
 template <typename T>
 concept HasMetaDescribe = requires(FVulFieldSerializationContext& Ctx, TSharedPtr<FVulFieldDescription>& Description) {
 	{ TVulFieldMeta<T>::Describe(Ctx, Description) } -> std::same_as<bool>;
@@ -150,15 +175,15 @@ struct VULRUNTIME_API FVulFieldSerializationContext
 	template <typename T>
 	bool RegisterDescription(TSharedPtr<FVulFieldDescription>& Description, bool& AlreadyKnown)
 	{
-		if (State.TypeDescriptions.Contains(VulRuntime::Field::TypeId<T>()))
+		const auto& TypeId = VulRuntime::Field::TypeId<T>();
+		if (const auto Known = State.TypeDescriptions.Find(TypeId))
 		{
-			Description = State.TypeDescriptions[VulRuntime::Field::TypeId<T>()];
+			Description = *Known;
 			AlreadyKnown = true;
 			return true;
 		}
 
-		const auto TypeId = VulRuntime::Field::TypeId<T>(); 
-		if (KnownTypeName(TypeId).IsSet())
+		if (KnownTypeName(VulRuntime::Field::TypeKey<T>()) != nullptr)
 		{
 			Description->BindToType<T>();
 				
@@ -181,9 +206,10 @@ struct VULRUNTIME_API FVulFieldSerializationContext
 		TSharedPtr<FVulFieldDescription>& Description,
 		const TOptional<VulRuntime::Field::FPathItem>& IdentifierCtx = {}
 	) {
+		const auto FlagScope = Flags.Enter(IdentifierCtx);
 		return State.Errors.WithIdentifierCtx(IdentifierCtx, [&]
 		{
-			const bool SupportsRef = Flags.SupportsReferencing<T>(State.Errors.GetPath());
+			const bool SupportsRef = Flags.SupportsReferencing<T>();
 			
 			bool AlreadyKnown = false;
 			if (!RegisterDescription<T>(Description, AlreadyKnown))
@@ -225,9 +251,9 @@ struct VULRUNTIME_API FVulFieldSerializationContext
 				);
 			}
 
-			if (Description->IsObject() && Flags.IsEnabled(VulFieldSerializationFlag_AnnotateTypes, State.Errors.GetPath()))
+			if (Description->IsObject() && Flags.IsEnabled(VulFieldSerializationFlag_AnnotateTypes))
 			{
-				if (const auto KnownType = KnownTypeName(VulRuntime::Field::TypeId<T>()); KnownType.IsSet())
+				if (const auto KnownType = KnownTypeName(VulRuntime::Field::TypeKey<T>()))
 				{
 					const auto Desc = MakeShared<FVulFieldDescription>();
 
@@ -238,7 +264,7 @@ struct VULRUNTIME_API FVulFieldSerializationContext
 						Desc->String();
 					} else
 					{
-						Desc->Const(MakeShared<FJsonValueString>(KnownType.GetValue()));
+						Desc->Const(MakeShared<FJsonValueString>(*KnownType));
 					}
 					
 					Description->Prop("VulType", Desc, true);
@@ -260,9 +286,10 @@ struct VULRUNTIME_API FVulFieldSerializationContext
 			TVulFieldSerializer<T>::Setup();
 		}
 		
+		const auto FlagScope = Flags.Enter(IdentifierCtx);
 		return State.Errors.WithIdentifierCtx(IdentifierCtx, [&]
 		{
-			const bool SupportsRef = Flags.SupportsReferencing<T>(State.Errors.GetPath());
+			const bool SupportsRef = Flags.SupportsReferencing<T>();
 
 			bool IsOuterObject = false;
 			if (ExtractReferences && !State.Memory.Refs.IsValid())
@@ -293,11 +320,11 @@ struct VULRUNTIME_API FVulFieldSerializationContext
 			}
 
 			TSharedPtr<FJsonObject>* Obj;
-			if (Out->TryGetObject(Obj) && Flags.IsEnabled(VulFieldSerializationFlag_AnnotateTypes, State.Errors.GetPath()))
+			if (Out->TryGetObject(Obj) && Flags.IsEnabled(VulFieldSerializationFlag_AnnotateTypes))
 			{
-				if (const auto Known = KnownTypeName(VulRuntime::Field::TypeId<T>()); Known.IsSet())
+				if (const auto Known = KnownTypeName(VulRuntime::Field::TypeKey<T>()))
 				{
-					Obj->Get()->SetField(TEXT("VulType"), MakeShared<FJsonValueString>(Known.GetValue()));
+					Obj->Get()->SetField(TEXT("VulType"), MakeShared<FJsonValueString>(*Known));
 				}
 			}
 
@@ -327,8 +354,97 @@ struct VULRUNTIME_API FVulFieldSerializationContext
 		});
 	}
 
+	/**
+	 * Serializes Value straight in to Out, without building an intermediate FJsonValue tree.
+	 *
+	 * Types whose TVulFieldSerializer has no streaming Serialize overload are serialized to an
+	 * FJsonValue as normal, then written to Out, so all serializable types are supported.
+	 *
+	 * ExtractReferences is not supported as it requires the whole output before the refs can
+	 * be written. On failure, Out will contain incomplete output.
+	 */
+	template <typename T>
+	bool Serialize(
+		const T& Value,
+		FVulFieldWriter& Out,
+		const TOptional<VulRuntime::Field::FPathItem>& IdentifierCtx = {}
+	) {
+		if constexpr (SerializerHasSetup<T>)
+		{
+			TVulFieldSerializer<T>::Setup();
+		}
+		
+		const auto FlagScope = Flags.Enter(IdentifierCtx);
+		return State.Errors.WithIdentifierCtx(IdentifierCtx, [&]
+		{
+			if (ExtractReferences)
+			{
+				State.Errors.Add(TEXT("ExtractReferences is not supported when streaming serialization"));
+				return false;
+			}
+			
+			FString RefString;
+
+			if (Flags.SupportsReferencing<T>())
+			{
+				TSharedPtr<FJsonValue> Ref;
+				if (!State.ResolveRef(Value, Ref))
+				{
+					return false;
+				}
+
+				if (Ref.IsValid())
+				{
+					RefString = Ref->AsString();
+
+					if (State.Memory.Store.Contains(RefString))
+					{
+						Out.String(RefString);
+						return true;
+					}
+				}
+			}
+
+			if (Flags.IsEnabled(VulFieldSerializationFlag_AnnotateTypes))
+			{
+				if (const auto Known = KnownTypeName(VulRuntime::Field::TypeKey<T>()))
+				{
+					Out.AnnotateNextObject(*Known);
+				}
+			}
+
+			if constexpr (SerializerHasStream<T>)
+			{
+				if (!TVulFieldSerializer<T>::Serialize(Value, Out, *this))
+				{
+					return false;
+				}
+			} else
+			{
+				TSharedPtr<FJsonValue> Json;
+				if (!TVulFieldSerializer<T>::Serialize(Value, Json, *this))
+				{
+					return false;
+				}
+
+				Out.Json(Json);
+			}
+
+			if (!RefString.IsEmpty())
+			{
+				// Only presence matters when serializing; there is no FJsonValue to point to.
+				State.Memory.Store.Add(RefString, nullptr);
+			}
+			
+			return true;
+		});
+	}
+
 private:
-	static TOptional<FString> KnownTypeName(const FString& TypeId);
+	/**
+	 * The registered name of the type with the given VulRuntime::Field::TypeKey, or nullptr if not registered.
+	 */
+	static const FString* KnownTypeName(const uint64 TypeKey);
 	static bool IsBaseType(const FString& TypeId);
 
 	/**
@@ -359,9 +475,10 @@ struct VULRUNTIME_API FVulFieldDeserializationContext
 			TVulFieldSerializer<T>::Setup();
 		}
 		
+		const auto FlagScope = Flags.Enter(IdentifierCtx);
 		return State.Errors.WithIdentifierCtx(IdentifierCtx, [&]
 		{
-			const bool SupportsRef = Flags.SupportsReferencing<T>(State.Errors.GetPath());
+			const bool SupportsRef = Flags.SupportsReferencing<T>();
 			
 			if (SupportsRef)
 			{
@@ -398,5 +515,79 @@ struct VULRUNTIME_API FVulFieldDeserializationContext
 			return true;
 		});
 	}
+
+	/**
+	 * Deserializes the current value of In in to Out, without building an intermediate FJsonValue
+	 * tree, consuming it from In.
+	 *
+	 * Types whose TVulFieldSerializer has no streaming Deserialize overload have their value read
+	 * in to an FJsonValue and deserialized as normal, so all serializable types are supported.
+	 */
+	template<typename T>
+	bool Deserialize(FVulFieldReader& In, T& Out, const TOptional<VulRuntime::Field::FPathItem>& IdentifierCtx = {})
+	{
+		if constexpr (SerializerHasSetup<T>)
+		{
+			TVulFieldSerializer<T>::Setup();
+		}
+		
+		const auto FlagScope = Flags.Enter(IdentifierCtx);
+		return State.Errors.WithIdentifierCtx(IdentifierCtx, [&]
+		{
+			const bool SupportsRef = Flags.SupportsReferencing<T>();
+			
+			if (SupportsRef)
+			{
+				if constexpr (std::is_copy_assignable_v<T>)
+				{
+					if (In.Peek() == EJson::String)
+					{
+						if (const auto Stored = State.Memory.Store.Find(FString(In.StringView())))
+						{
+							Out = *static_cast<T*>(*Stored);
+							return In.Skip();
+						}
+					}
+				}
+			}
+
+			if constexpr (DeserializerHasStream<T>)
+			{
+				if (!TVulFieldSerializer<T>::Deserialize(In, Out, *this))
+				{
+					return false;
+				}
+			} else
+			{
+				TSharedPtr<FJsonValue> Data;
+				if (!In.Json(Data))
+				{
+					State.Errors.Add(TEXT("cannot read value: %s"), *In.DescribeError());
+					return false;
+				}
+				
+				if (!TVulFieldSerializer<T>::Deserialize(Data, Out, *this))
+				{
+					return false;
+				}
+			}
+
+			if (SupportsRef)
+			{
+				TSharedPtr<FJsonValue> Ref;
+				if (!State.ResolveRef(Out, Ref))
+				{
+					return false;
+				}
+
+				if (Ref.IsValid())
+				{
+					State.Memory.Store.Add(Ref->AsString(), &Out);
+				}
+			}
+
+			return true;
+		});
+	}
 };
 
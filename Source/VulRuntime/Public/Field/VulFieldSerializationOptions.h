@@ -42,11 +42,22 @@ struct VULRUNTIME_API FVulFieldSerializationFlags
 	 * Optionally set Path to only apply at that point in the de/serialization tree.
 	 *
 	 * The path expects dot-separated with numeric and property wildcards, e.g. ".foo.*.arr[*].baz".
+	 * Paths are compiled when set, so prefer setting flags before de/serializing rather than during.
 	 */
 	void Set(const FString& Option, const bool Value = true, const FString& Path = "");
 
+	/**
+	 * Resolves Option at Path. Paths set first take precedence, then those set without a path,
+	 * then defaults.
+	 */
 	bool IsEnabled(const FString& Option, const VulRuntime::Field::FPath& Path) const;
 
+	/**
+	 * Resolves Option where de/serialization currently is, as tracked by Enter. This does not
+	 * look at the path, so is cheap regardless of depth.
+	 */
+	bool IsEnabled(const FString& Option) const;
+
 	template <typename T>
 	bool SupportsReferencing(const VulRuntime::Field::FPath& Path) const
 	{
@@ -54,15 +65,87 @@ struct VULRUNTIME_API FVulFieldSerializationFlags
 		return TypeSupportsRef && IsEnabled(VulFieldSerializationFlag_Referencing, Path);
 	}
 
+	/**
+	 * As above, where de/serialization currently is.
+	 */
+	template <typename T>
+	bool SupportsReferencing() const
+	{
+		const bool TypeSupportsRef = TVulFieldRefResolver<T>::SupportsRef();
+		return TypeSupportsRef && IsEnabled(VulFieldSerializationFlag_Referencing);
+	}
+
 	static void RegisterDefault(const FString& Option, const bool Default)
 	{
 		GlobalDefaults.Add(Option, Default);
 	}
+
+	/**
+	 * Leaves the path item entered by FVulFieldSerializationFlags::Enter when destroyed.
+	 */
+	struct FScope
+	{
+		~FScope();
+		FScope(const FScope&) = delete;
+		FScope& operator=(const FScope&) = delete;
+
+	private:
+		friend FVulFieldSerializationFlags;
+		explicit FScope(FVulFieldSerializationFlags* InFlags) : Flags(InFlags) {}
+		FVulFieldSerializationFlags* Flags;
+	};
+
+	/**
+	 * Tracks de/serialization moving in to Item, if set, until the returned scope ends, so that
+	 * path-scoped flags are matched one item at a time as the tree is traversed.
+	 *
+	 * Item is referenced, not copied, so must outlive the scope. De/serialization contexts do this
+	 * alongside FVulFieldSerializationErrors::WithIdentifierCtx.
+	 */
+	[[nodiscard]] FScope Enter(const TOptional<VulRuntime::Field::FPathItem>& Item);
+	[[nodiscard]] FScope Enter(const VulRuntime::Field::FPathItem& Item);
+	FScope Enter(TOptional<VulRuntime::Field::FPathItem>&&) = delete;
+	FScope Enter(VulRuntime::Field::FPathItem&&) = delete;
 	
 private:
 	TMap<FString, TMap<FString, bool>> PathFlags;
+
+	/**
+	 * PathFlags compiled for resolution. Shared between copies, and replaced entirely on Set.
+	 */
+	struct FCompiled
+	{
+		VulRuntime::Field::FPathMatcher Matcher;
+
+		/**
+		 * Flags for each path, indexed by pattern ID.
+		 */
+		TArray<TMap<FString, bool>> PatternFlags;
+
+		/**
+		 * Flags set without a path.
+		 */
+		TMap<FString, bool> Unscoped;
+	};
+
+	TSharedPtr<const FCompiled> Compiled;
+
+	struct FEntered
+	{
+		const VulRuntime::Field::FPathItem* Item;
+
+		/**
+		 * The matcher state of the path up to and including Item.
+		 */
+		VulRuntime::Field::FPathMatcher::FState State;
+	};
+
+	/**
+	 * Each item entered, so the last is the current path.
+	 */
+	TArray<FEntered, TInlineAllocator<16>> Entered;
 	
-	bool Resolve(const FString& Option, const VulRuntime::Field::FPath& Path) const;
+	bool Resolve(const FString& Option, const VulRuntime::Field::FPathMatcher::FState& State) const;
 
 	static TMap<FString, bool> GlobalDefaults;
 };
\ No newline at end of file
@@ -4,6 +4,15 @@
  * This struct must be implemented for each type you want to support with FVulField de/serialization.
  *
  * See VulFieldCommonSerializers.h for example implementations.
+ *
+ * Optionally, also implement a Serialize overload that writes to a FVulFieldWriter instead of
+ * an FJsonValue, so the type can be streamed without building an FJsonValue tree:
+ *
+ *   static bool Serialize(const T& Value, FVulFieldWriter& Out, FVulFieldSerializationContext& Ctx)
+ *
+ * And similarly a Deserialize overload that reads from a FVulFieldReader:
+ *
+ *   static bool Deserialize(FVulFieldReader& In, T& Out, FVulFieldDeserializationContext& Ctx)
  */
 template <typename T>
 struct TVulFieldSerializer
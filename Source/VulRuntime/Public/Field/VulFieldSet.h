@@ -36,6 +36,12 @@ struct VULRUNTIME_API FVulFieldSet
 			const TOptional<VulRuntime::Field::FPathItem>& IdentifierCtx
 		)> Fn = nullptr;
 		
+		TFunction<bool (
+			FVulFieldWriter&,
+			FVulFieldSerializationContext&,
+			const TOptional<VulRuntime::Field::FPathItem>& IdentifierCtx
+		)> StreamFn = nullptr;
+		
 		TFunction<bool (
 			FVulFieldSerializationContext& Ctx,
 			TSharedPtr<FVulFieldDescription>& Description,
@@ -78,6 +84,14 @@ struct VULRUNTIME_API FVulFieldSet
 			return Ctx.Serialize<T>(Fn(), Out, IdentifierCtx);
 		};
 		
+		Created.StreamFn = [Fn](
+			FVulFieldWriter& Out,
+			FVulFieldSerializationContext& Ctx,
+			const TOptional<VulRuntime::Field::FPathItem>& IdentifierCtx
+		) {
+			return Ctx.Serialize<T>(Fn(), Out, IdentifierCtx);
+		};
+		
 		if (IsRef)
 		{
 			RefField = Identifier;
@@ -91,9 +105,9 @@ struct VULRUNTIME_API FVulFieldSet
 			return Ctx.Describe<T>(Description, IdentifierCtx);
 		};
 
-		if (FVulFieldRegistry::Get().Has<T>())
+		if (const auto Registered = FVulFieldRegistry::Get().Find<T>())
 		{
-			Created.TypeId = FVulFieldRegistry::Get().GetType<T>()->TypeId;
+			Created.TypeId = Registered->TypeId;
 		}
 
 		return Entries.Add(Identifier, Created);
@@ -118,8 +132,23 @@ struct VULRUNTIME_API FVulFieldSet
 
 	bool Serialize(TSharedPtr<FJsonValue>& Out) const;
 	bool Serialize(TSharedPtr<FJsonValue>& Out, FVulFieldSerializationContext& Ctx) const;
+
+	/**
+	 * Streams this field set in to Out without building an intermediate FJsonValue.
+	 *
+	 * @see FVulFieldSerializationContext::Serialize.
+	 */
+	bool Serialize(FVulFieldWriter& Out, FVulFieldSerializationContext& Ctx) const;
 	bool Deserialize(const TSharedPtr<FJsonValue>& Data);
 	bool Deserialize(const TSharedPtr<FJsonValue>& Data, FVulFieldDeserializationContext& Ctx);
+
+	/**
+	 * Deserializes this field set by pulling its properties from In, without building an
+	 * intermediate FJsonValue. Unknown properties are skipped.
+	 *
+	 * @see FVulFieldDeserializationContext::Deserialize.
+	 */
+	bool Deserialize(FVulFieldReader& In, FVulFieldDeserializationContext& Ctx);
 	
 	template <typename CharType = TCHAR, typename PrintPolicy = TCondensedJsonPrintPolicy<CharType>>
 	bool SerializeToJson(FString& Out, FVulFieldSerializationContext& Ctx) const
@@ -141,6 +170,22 @@ struct VULRUNTIME_API FVulFieldSet
 		return SerializeToJson<CharType, PrintPolicy>(Out, Ctx);
 	}
 
+	/**
+	 * Serializes to a condensed JSON string, streaming the output rather than building an
+	 * FJsonValue first. Much faster & leaner than SerializeToJson for large data.
+	 */
+	bool StreamToJson(FString& Out, FVulFieldSerializationContext& Ctx) const;
+	bool StreamToJson(FString& Out) const;
+
+	/**
+	 * Streams to & from the compact binary format of FVulFieldBinaryWriter, e.g. for save games
+	 * or network payloads.
+	 */
+	bool StreamToBinary(TArray<uint8>& Out, FVulFieldSerializationContext& Ctx) const;
+	bool StreamToBinary(TArray<uint8>& Out) const;
+	bool StreamFromBinary(const TArrayView<const uint8> Data, FVulFieldDeserializationContext& Ctx);
+	bool StreamFromBinary(const TArrayView<const uint8> Data);
+
 	template <typename CharType = TCHAR>
 	bool DeserializeFromJson(const FString& JsonStr, FVulFieldDeserializationContext& Ctx)
 	{
@@ -161,6 +206,13 @@ struct VULRUNTIME_API FVulFieldSet
 		return DeserializeFromJson<CharType>(JsonStr, Ctx);
 	}
 
+	/**
+	 * Deserializes from a JSON string, streaming the input rather than parsing it to an
+	 * FJsonValue first. Much faster & leaner than DeserializeFromJson for large data.
+	 */
+	bool StreamFromJson(const FString& JsonStr, FVulFieldDeserializationContext& Ctx);
+	bool StreamFromJson(const FString& JsonStr);
+
 	bool Describe(FVulFieldSerializationContext& Ctx, TSharedPtr<FVulFieldDescription>& Description) const;
 private:
 	TMap<FString, FEntry> Entries;
@@ -201,6 +253,11 @@ struct TVulFieldSerializer<T>
 		return Value.VulFieldSet().Serialize(Out, Ctx);
 	}
 
+	static bool Serialize(const T& Value, FVulFieldWriter& Out, FVulFieldSerializationContext& Ctx)
+	{
+		return Value.VulFieldSet().Serialize(Out, Ctx);
+	}
+
 	static bool Deserialize(const TSharedPtr<FJsonValue>& Data, T& Out, FVulFieldDeserializationContext& Ctx)
 	{
 		auto Result = Out.VulFieldSet().Deserialize(Data, Ctx);
@@ -210,6 +267,11 @@ struct TVulFieldSerializer<T>
 		}
 		return Result;
 	}
+
+	static bool Deserialize(FVulFieldReader& In, T& Out, FVulFieldDeserializationContext& Ctx)
+	{
+		return Out.VulFieldSet().Deserialize(In, Ctx);
+	}
 };
 
 template <typename T>
@@ -305,7 +367,7 @@ struct TVulFieldSerializer<T*>
 			return FieldSetObj->VulFieldSet().Serialize(Out, Ctx);
 		}
 		
-		if (Ctx.Flags.IsEnabled(VulFieldSerializationFlag_AssetReferencing, Ctx.State.Errors.GetPath()) && Value->IsAsset())
+		if (Ctx.Flags.IsEnabled(VulFieldSerializationFlag_AssetReferencing) && Value->IsAsset())
 		{
 			const auto Path = FSoftObjectPath(Value);
 			Out = MakeShared<FJsonValueString>(Path.ToString());
@@ -317,6 +379,30 @@ struct TVulFieldSerializer<T*>
 		return true;
 	}
 
+	static bool Serialize(const T* const& Value, FVulFieldWriter& Out, FVulFieldSerializationContext& Ctx)
+	{
+		if (!IsValid(Value))
+		{
+			Out.Null();
+			return true;
+		}
+		
+		if (auto FieldSetObj = Cast<IVulFieldSetAware>(Value); FieldSetObj != nullptr)
+		{
+			return FieldSetObj->VulFieldSet().Serialize(Out, Ctx);
+		}
+		
+		if (Ctx.Flags.IsEnabled(VulFieldSerializationFlag_AssetReferencing) && Value->IsAsset())
+		{
+			Out.String(FSoftObjectPath(Value).ToString());
+			return true;
+		}
+
+		Out.BeginObject();
+		Out.EndObject();
+		return true;
+	}
+
 	static bool Deserialize(const TSharedPtr<FJsonValue>& Data, T*& Out, FVulFieldDeserializationContext& Ctx)
 	{
 		if (Data->Type == EJson::Null)
@@ -325,7 +411,7 @@ struct TVulFieldSerializer<T*>
 			return true;
 		}
 		
-		if (Ctx.Flags.IsEnabled(VulFieldSerializationFlag_AssetReferencing, Ctx.State.Errors.GetPath()))
+		if (Ctx.Flags.IsEnabled(VulFieldSerializationFlag_AssetReferencing))
 		{
 			FString AsStr;
 			if (Data->TryGetString(AsStr) && FSoftObjectPath(AsStr).IsValid())
@@ -344,6 +430,36 @@ struct TVulFieldSerializer<T*>
 		
 		return true;
 	}
+
+	static bool Deserialize(FVulFieldReader& In, T*& Out, FVulFieldDeserializationContext& Ctx)
+	{
+		if (In.Null())
+		{
+			Out = nullptr;
+			return true;
+		}
+		
+		if (Ctx.Flags.IsEnabled(VulFieldSerializationFlag_AssetReferencing))
+		{
+			if (In.Peek() == EJson::String)
+			{
+				if (const FString AsStr(In.StringView()); FSoftObjectPath(AsStr).IsValid())
+				{
+					Out = LoadObject<T>(Ctx.ObjectOuter, *AsStr);
+					return In.Skip();
+				}
+			}
+		}
+		
+		Out = NewObject<T>(Ctx.ObjectOuter, Out->StaticClass());
+
+		if (auto FieldSetObj = Cast<IVulFieldSetAware>(Out); FieldSetObj != nullptr)
+		{
+			return FieldSetObj->VulFieldSet().Deserialize(In, Ctx);
+		}
+		
+		return In.Skip();
+	}
 };
 
 template<typename T>
@@ -354,6 +470,11 @@ struct TVulFieldSerializer<TScriptInterface<T>>
 		return Ctx.Serialize(Value.GetObject(), Out);
 	}
 	
+	static bool Serialize(const TScriptInterface<T>& Value, FVulFieldWriter& Out, FVulFieldSerializationContext& Ctx)
+	{
+		return Ctx.Serialize(Value.GetObject(), Out);
+	}
+	
 	static bool Deserialize(const TSharedPtr<FJsonValue>& Data, TScriptInterface<T>& Out, FVulFieldDeserializationContext& Ctx)
 	{
 		UObject* Obj;
@@ -372,6 +493,25 @@ struct TVulFieldSerializer<TScriptInterface<T>>
 		Out.SetInterface(Cast<T>(Obj));
 		return true;
 	}
+	
+	static bool Deserialize(FVulFieldReader& In, TScriptInterface<T>& Out, FVulFieldDeserializationContext& Ctx)
+	{
+		UObject* Obj;
+		if (!Ctx.Deserialize(In, Obj))
+		{
+			return false;
+		}
+
+		if (Cast<T>(Obj) == nullptr)
+		{
+			Ctx.State.Errors.Add(TEXT("deserialized object of class which does not implement the expected interface"));
+			return false;
+		}
+
+		Out.SetObject(Obj);
+		Out.SetInterface(Cast<T>(Obj));
+		return true;
+	}
 };
 
 template <typename T>
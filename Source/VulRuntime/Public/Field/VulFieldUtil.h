@@ -48,10 +48,94 @@ namespace VulRuntime::Field
 	 * Wildcards are supported for non-numeric properties, but will only match a single property.
 	 * E.g. ".foo.*" will match ".foo.bar", but not ".foo.bar.baz".
 	 *
+	 * Path also matches if it runs out first, i.e. it leads to the paths Match describes, including
+	 * when its last property is the start of the property name in Match. So the root path matches
+	 * everything, and flags set for a path also apply on the way to it.
+	 *
 	 * This match ignores case.
 	 */
 	VULRUNTIME_API bool PathMatch(const FPath& Path, const FString& Match);
 
+	/**
+	 * Many PathMatch patterns compiled in to a trie, so they can all be matched against a path at once,
+	 * one path item at a time, without walking pattern strings.
+	 *
+	 * De/serialization steps a state along with its traversal, so checking which patterns match the
+	 * current path costs the same no matter how deep in the tree it is.
+	 */
+	struct VULRUNTIME_API FPathMatcher
+	{
+		/**
+		 * The trie nodes reached by a path so far. Empty once no pattern can match.
+		 *
+		 * A negated node (~Node) was reached by a property that is only the start of its name, so
+		 * matches if the path ends there but cannot be stepped from.
+		 */
+		using FState = TArray<int32, TInlineAllocator<2>>;
+
+		/**
+		 * Compiles Pattern, returning its ID, or INDEX_NONE if it is not a valid pattern.
+		 *
+		 * IDs are assigned in order from 0, so a lower ID is a pattern that was added earlier.
+		 */
+		int32 Add(const FString& Pattern);
+
+		/**
+		 * The state of the empty (root) path.
+		 */
+		FState Start() const;
+
+		/**
+		 * Sets Out to the state after following From in to Item.
+		 */
+		void Step(const FState& From, const FPathItem& Item, FState& Out) const;
+
+		/**
+		 * Steps from the root through all of Path.
+		 */
+		FState Match(const FPath& Path) const;
+
+		/**
+		 * Invokes Fn with the ID of each pattern that matches the path that reached State, as per
+		 * PathMatch. An ID may be given more than once.
+		 */
+		template <typename FnType>
+		void ForEachMatch(const FState& State, const FnType& Fn) const
+		{
+			for (const auto Node : State)
+			{
+				for (const auto Id : Nodes[Node < 0 ? ~Node : Node].Patterns)
+				{
+					Fn(Id);
+				}
+			}
+		}
+
+	private:
+		struct FNode
+		{
+			TMap<FString, int32> Properties;
+
+			/**
+			 * The negated nodes (~Node) of Properties whose names start with, but are longer than, each key.
+			 */
+			TMap<FString, TArray<int32, TInlineAllocator<1>>> Prefixes;
+
+			int32 AnyProperty = INDEX_NONE;
+			TMap<int, int32> Indices;
+			int32 AnyIndex = INDEX_NONE;
+
+			/**
+			 * IDs of the patterns that end at or pass through this node, all of which a path reaching
+			 * this node matches.
+			 */
+			TArray<int32, TInlineAllocator<1>> Patterns;
+		};
+
+		TArray<FNode> Nodes;
+		int32 NextId = 0;
+	};
+
 	/**
 	 * Helper to return the string representation of the given JSON type.
 	 */
@@ -119,10 +203,28 @@ namespace VulRuntime::Field
 	 *
 	 * Note: This ID is not stable across builds and should not be used for persistent storage
 	 * or communication between different binaries.
+	 *
+	 * The hash is computed once per type and cached, so this is cheap to call in hot paths.
+	 */
+	template <typename T>
+	const FString& TypeId()
+	{
+		static const FString Id = FMD5::HashAnsiString(*TypeInfo<T>());
+		return Id;
+	}
+
+	/**
+	 * An integer key for a type ID, as used by FVulFieldRegistry for lookups.
+	 */
+	VULRUNTIME_API uint64 TypeKey(const FString& TypeId);
+
+	/**
+	 * The integer key for the C++ type `T`, cached once per type. @see TypeId.
 	 */
 	template <typename T>
-	FString TypeId()
+	uint64 TypeKey()
 	{
-		return FMD5::HashAnsiString(*TypeInfo<T>());
+		static const uint64 Key = TypeKey(TypeId<T>());
+		return Key;
 	}
 }
\ No newline at end of file
@@ -0,0 +1,129 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * A destination for streaming FVulField serialization.
+ *
+ * Serializers write their values here in order, instead of building an FJsonValue tree, so
+ * output is produced without intermediate allocations. Containers are opened and closed with
+ * Begin/End calls, and each object property is a Key followed by exactly one value.
+ *
+ * This type tracks the structure being written so that fields that turn out to be empty can be
+ * rewound, mirroring VulRuntime::Field::IsEmpty for the DOM API. Output formats implement the
+ * protected Write functions; @see FVulFieldJsonWriter.
+ */
+struct VULRUNTIME_API FVulFieldWriter
+{
+	virtual ~FVulFieldWriter() = default;
+
+	void Null();
+	void Bool(const bool Value);
+	void Int(const int64 Value);
+
+	/**
+	 * Writes a floating point value to Precision decimal places, or if INDEX_NONE, with 17
+	 * significant digits like UE's JSON writer, which always round-trips but is not the shortest.
+	 */
+	void Double(const double Value, const int32 Precision = INDEX_NONE);
+
+	/**
+	 * Writes a number that has already been formatted, e.g. from an FJsonValueNumberString.
+	 */
+	void RawNumber(const FString& Value);
+
+	void String(const FString& Value);
+
+	void BeginArray();
+	void EndArray();
+	void BeginObject();
+	void EndObject();
+
+	/**
+	 * Writes the name of the next property of the current object. Must be followed by its value.
+	 */
+	void Key(const FString& Name);
+
+	/**
+	 * Writes an existing FJsonValue tree, for serializers that have no streaming implementation.
+	 */
+	void Json(const TSharedPtr<FJsonValue>& Value);
+
+	/**
+	 * True if the last complete value written was empty as per VulRuntime::Field::IsEmpty.
+	 */
+	bool WasEmpty() const { return bLastEmpty; }
+
+	/**
+	 * If the next value written at the current depth is an object, adds a "VulType" property
+	 * with TypeName to it. Used by VulFieldSerializationFlag_AnnotateTypes.
+	 *
+	 * If an annotation is already pending at this depth, that one is kept: a type whose serializer
+	 * writes through another registered type is annotated as itself, as with the DOM API.
+	 */
+	void AnnotateNextObject(const FString& TypeName);
+
+	/**
+	 * A point in the output that can be returned to with Rewind.
+	 */
+	struct FMark
+	{
+		int64 Position = 0;
+		int32 Depth = 0;
+		int32 Num = 0;
+		bool bAllEmpty = true;
+	};
+
+	FMark GetMark() const;
+
+	/**
+	 * Discards everything written since Mark was taken. Must be called at the same depth.
+	 */
+	void Rewind(const FMark& Mark);
+
+protected:
+	virtual void WriteNull() = 0;
+	virtual void WriteBool(const bool Value) = 0;
+	virtual void WriteInt(const int64 Value) = 0;
+	virtual void WriteDouble(const double Value, const int32 Precision) = 0;
+	virtual void WriteRawNumber(const FString& Value) = 0;
+	virtual void WriteString(const FString& Value) = 0;
+	virtual void WriteBeginArray() = 0;
+	virtual void WriteEndArray() = 0;
+	virtual void WriteBeginObject() = 0;
+	virtual void WriteEndObject() = 0;
+	virtual void WriteKey(const FString& Name) = 0;
+
+	/**
+	 * Called between entries of an array or object, before the entry's key or value.
+	 */
+	virtual void WriteSeparator() = 0;
+
+	/**
+	 * The current length of the output, and truncation back to it, for Rewind.
+	 */
+	virtual int64 GetPosition() const = 0;
+	virtual void Truncate(const int64 Position) = 0;
+
+private:
+	struct FFrame
+	{
+		bool bIsObject = false;
+		int32 Num = 0;
+		bool bAllEmpty = true;
+		TOptional<FString> Annotation;
+	};
+
+	TArray<FFrame, TInlineAllocator<16>> Stack;
+	bool bAfterKey = false;
+	bool bLastEmpty = true;
+	TOptional<FString> PendingAnnotation;
+	int32 PendingAnnotationDepth = INDEX_NONE;
+
+	/**
+	 * Bookkeeping common to the start of every value, returning the annotation it should take
+	 * if it's an object.
+	 */
+	TOptional<FString> BeginValue();
+	void EndValue(const bool bEmpty);
+};
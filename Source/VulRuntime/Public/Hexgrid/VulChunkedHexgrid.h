@@ -0,0 +1,664 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "VulHexgrid.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+/**
+ * A hexgrid that covers the entire (unbounded) plane, storing its tiles in fixed-size chunks that
+ * are created on demand.
+ *
+ * Where @see TVulHexgrid allocates every tile up-front, this only holds the chunks that are being
+ * used. A chunk's tiles are created by the grid's FVulTileAllocator the first time any of them is
+ * accessed, and once more than a budget of chunks are resident, the least recently used are evicted.
+ * This suits procedurally generated worlds that are too large to keep in memory.
+ *
+ * Chunks are ChunkSize by ChunkSize rhombuses in axial (q, r) coordinates, so the chunk holding a
+ * tile and its position within it are a division away.
+ *
+ * An evicted chunk is regenerated by the allocator when it is next needed, so the allocator must be
+ * deterministic. Chunks with modified tiles are handed to a pager to save instead, and are restored
+ * from it, @see SetPager. Without a pager, modified chunks are never evicted.
+ *
+ * Tiles are loaded by queries, so even const functions modify this grid and none are threadsafe.
+ * References to tiles are valid until the next call that may evict chunks.
+ */
+template <typename TileData, typename CostType = int>
+struct TVulChunkedHexgrid
+{
+	typedef TVulHexgrid<TileData, CostType> FDenseGrid;
+	typedef typename FDenseGrid::FVulTile FVulTile;
+	typedef typename FDenseGrid::FVulTileAllocator FVulTileAllocator;
+	typedef typename FDenseGrid::FVulTileValidFn FVulTileValidFn;
+	typedef typename FDenseGrid::FTraceResult FTraceResult;
+	typedef typename FDenseGrid::FPathResult FPathResult;
+
+	/**
+	 * Saves modified chunks when they are evicted, and restores them when they're next loaded.
+	 *
+	 * Chunks are identified by their chunk coordinates, @see ChunkOf. Tiles are in a fixed order
+	 * within a chunk, so only their data is stored.
+	 */
+	struct FChunkPager
+	{
+		/**
+		 * Stores the tile data of a chunk, returning false if it could not be stored.
+		 */
+		TFunction<bool (const FIntPoint& Chunk, const TArray<TileData>& Data)> Save;
+
+		/**
+		 * Restores the tile data previously saved for a chunk, returning false if there is none.
+		 */
+		TFunction<bool (const FIntPoint& Chunk, TArray<TileData>& OutData)> Load;
+	};
+
+	/**
+	 * A pager that saves a file per chunk in Directory.
+	 *
+	 * TileData must be serializable via FArchive's operator<<.
+	 */
+	static FChunkPager FilePager(const FString& Directory)
+	{
+		const auto ChunkFile = [Directory](const FIntPoint& Chunk)
+		{
+			return FPaths::Combine(Directory, FString::Printf(TEXT("%d_%d.chunk"), Chunk.X, Chunk.Y));
+		};
+
+		return {
+			[ChunkFile](const FIntPoint& Chunk, const TArray<TileData>& Data)
+			{
+				TArray<uint8> Bytes;
+				FMemoryWriter Writer(Bytes);
+				Writer << const_cast<TArray<TileData>&>(Data);
+
+				return FFileHelper::SaveArrayToFile(Bytes, *ChunkFile(Chunk));
+			},
+			[ChunkFile](const FIntPoint& Chunk, TArray<TileData>& OutData)
+			{
+				TArray<uint8> Bytes;
+
+				if (!FFileHelper::LoadFileToArray(Bytes, *ChunkFile(Chunk), FILEREAD_Silent))
+				{
+					return false;
+				}
+
+				FMemoryReader Reader(Bytes);
+				Reader << OutData;
+
+				return !Reader.IsError();
+			},
+		};
+	}
+
+	/**
+	 * Options we provide to @see Path to customize the path-finding algorithm.
+	 *
+	 * As per TVulHexgrid::TVulQueryOptions, with a limit on how far a search may go, as the grid is
+	 * unbounded.
+	 */
+	struct TVulQueryOptions
+	{
+		typedef TFunction<TOptional<CostType> (const FVulTile& From, const FVulTile& To, const TVulChunkedHexgrid* Grid)> FCostFn;
+		typedef typename FDenseGrid::TVulQueryOptions::FHeuristicFn FHeuristicFn;
+
+		static TOptional<CostType> DefaultCostFn(const FVulTile& From, const FVulTile& To, const TVulChunkedHexgrid* Grid)
+		{
+			return 1;
+		}
+
+		TVulQueryOptions(
+			FCostFn InCostFn = &DefaultCostFn,
+			FHeuristicFn InHeuristic = &FDenseGrid::TVulQueryOptions::DefaultHeuristic
+		) : CostFn(InCostFn), Heuristic(InHeuristic) {}
+
+		FCostFn CostFn = &DefaultCostFn;
+
+		FHeuristicFn Heuristic = &FDenseGrid::TVulQueryOptions::DefaultHeuristic;
+
+		/**
+		 * The search gives up after visiting this many tiles, returning a path to the closest tile it
+		 * found. Without a limit, a search for an unreachable tile would load chunks forever.
+		 */
+		int32 MaxVisited = 1 << 16;
+	};
+
+	/**
+	 * Creates a grid whose tiles are created by Allocator, in chunks of ChunkSize by ChunkSize tiles.
+	 *
+	 * At most MaxResidentChunks chunks are kept in memory, @see SetMaxResidentChunks.
+	 */
+	explicit TVulChunkedHexgrid(const int32 InChunkSize, const FVulTileAllocator& InAllocator, const int32 InMaxResidentChunks = 64)
+		: ChunkSize(InChunkSize), Allocator(InAllocator)
+	{
+		checkf(InChunkSize > 0, TEXT("Hexgrid chunk size must be greater than 0"))
+
+		SetMaxResidentChunks(InMaxResidentChunks);
+	}
+
+	int32 GetChunkSize() const
+	{
+		return ChunkSize;
+	}
+
+	/**
+	 * Sets how many chunks are kept in memory, evicting least recently used chunks over this budget.
+	 *
+	 * A single query may load more chunks than this; they are evicted once it completes.
+	 */
+	void SetMaxResidentChunks(const int32 InMaxResidentChunks)
+	{
+		checkf(InMaxResidentChunks > 0, TEXT("Hexgrid must allow at least one resident chunk"))
+
+		MaxResidentChunks = InMaxResidentChunks;
+		EvictOverBudget();
+	}
+
+	int32 GetMaxResidentChunks() const
+	{
+		return MaxResidentChunks;
+	}
+
+	/**
+	 * Sets the pager that modified chunks are saved to when evicted, @see FChunkPager.
+	 */
+	void SetPager(const FChunkPager& InPager)
+	{
+		Pager = InPager;
+		EvictOverBudget();
+	}
+
+	/**
+	 * The number of chunks currently in memory.
+	 */
+	int32 ResidentChunkCount() const
+	{
+		return Chunks.Num();
+	}
+
+	/**
+	 * The coordinates of the chunk that holds Addr.
+	 */
+	FIntPoint ChunkOf(const FVulHexAddr& Addr) const
+	{
+		return FIntPoint(FloorDiv(Addr.Q, ChunkSize), FloorDiv(Addr.R, ChunkSize));
+	}
+
+	bool IsResident(const FIntPoint& Chunk) const
+	{
+		return Chunks.Contains(Chunk);
+	}
+
+	/**
+	 * Loads every chunk holding a tile within Range of Center, e.g. around the player ahead of
+	 * them needing it.
+	 *
+	 * Touches these chunks, so they're the last to be evicted.
+	 */
+	void Preload(const FVulHexAddr& Center, const int Range) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE_STR("VulHexgrid::Preload")
+
+		FQueryScope Scope(this);
+
+		TSet<FIntPoint> Loaded;
+
+		for (const auto Addr : FVulHexRange(Center, Range))
+		{
+			if (const auto ChunkCoord = ChunkOf(Addr); !Loaded.Contains(ChunkCoord))
+			{
+				Loaded.Add(ChunkCoord);
+				Chunk(ChunkCoord);
+			}
+		}
+	}
+
+	/**
+	 * Saves every resident modified chunk to the pager, e.g. before this grid is destroyed.
+	 *
+	 * Returns false if any modified chunk could not be saved, including when there is no pager.
+	 */
+	bool Flush()
+	{
+		bool Saved = true;
+
+		for (auto& Entry : Chunks)
+		{
+			if (Entry.Value->Modified)
+			{
+				Saved &= Pager.Save && PageOut(Entry.Key, *Entry.Value);
+			}
+		}
+
+		return Saved;
+	}
+
+	/**
+	 * Returns the tile at Addr, loading its chunk if needed.
+	 *
+	 * Every address is a tile in this grid.
+	 */
+	const FVulTile& TileAt(const FVulHexAddr& Addr) const
+	{
+		return Chunk(ChunkOf(Addr)).Tiles[LocalIndex(Addr)];
+	}
+
+	FVulTile GetTile(const FVulHexAddr& Addr) const
+	{
+		return TileAt(Addr);
+	}
+
+	void SetTileData(const FVulHexAddr& Addr, const TileData& Data)
+	{
+		ModifyTileData(Addr)->Data = Data;
+	}
+
+	/**
+	 * Returns a pointer to modify the tile at Addr in place.
+	 *
+	 * The pointer is valid until the next call that may evict chunks. The tile's chunk is assumed to
+	 * be modified, so is paged rather than discarded on eviction.
+	 */
+	FVulTile* ModifyTileData(const FVulHexAddr& Addr)
+	{
+		auto& Loaded = Chunk(ChunkOf(Addr));
+		Loaded.Modified = true;
+
+		return &Loaded.Tiles[LocalIndex(Addr)];
+	}
+
+	/**
+	 * Returns the tiles within MaxRange of To, closest first, as per TVulHexgrid::AdjacentTiles.
+	 */
+	TArray<FVulTile> AdjacentTiles(const FVulHexAddr& To, const int MaxRange = 1, const bool IncludeStart = false) const
+	{
+		FQueryScope Scope(this);
+
+		const FVulHexSpiral Spiral(To, MaxRange);
+
+		TArray<FVulTile> Out;
+		Out.Reserve(Spiral.Num());
+
+		for (const auto Addr : Spiral)
+		{
+			if (!(Addr == To) || IncludeStart)
+			{
+				Out.Add(TileAt(Addr));
+			}
+		}
+
+		return Out;
+	}
+
+	/**
+	 * Traces a straight line between From and To, as per TVulHexgrid::Trace.
+	 */
+	FTraceResult Trace(
+		const FVulHexAddr& From,
+		const FVulHexAddr& To,
+		const FVulTileValidFn& Check = [](const FVulTile&) { return true; },
+		const float Leeway = 0.01
+	) const {
+		TRACE_CPUPROFILER_EVENT_SCOPE_STR("VulHexgrid::Trace")
+
+		FQueryScope Scope(this);
+
+		const FVulHexLine Line(From, To);
+
+		FTraceResult Result;
+		Result.Tiles.Add(From);
+
+		for (auto Step = 1; Step <= Line.Num(); ++Step)
+		{
+			auto Tile = Line.At(Step);
+
+			if (Leeway > 0.f && !Check(TileAt(Tile)))
+			{
+				const auto Alternates = Line.Alternates(Step, Leeway);
+				const auto Alternate = Alternates.FindByPredicate([&](const FVulHexAddr& Candidate)
+				{
+					return Check(TileAt(Candidate));
+				});
+
+				if (Alternate == nullptr)
+				{
+					return Result;
+				}
+
+				Tile = *Alternate;
+			}
+
+			Result.Tiles.Add(Tile);
+		}
+
+		Result.Complete = true;
+		return Result;
+	}
+
+	/**
+	 * Finds a path between two tiles, From and To, as per TVulHexgrid::Path.
+	 *
+	 * Searches across chunks, loading them as needed. Gives up after Opts.MaxVisited tiles, returning
+	 * an incomplete path to the closest tile found.
+	 */
+	FPathResult Path(
+		const FVulHexAddr& From,
+		const FVulHexAddr& To,
+		const TVulQueryOptions& Opts = TVulQueryOptions()
+	) const {
+		TRACE_CPUPROFILER_EVENT_SCOPE_STR("VulHexgrid::Path")
+
+		if (From == To)
+		{
+			return {true, {}, 0};
+		}
+
+		FQueryScope Scope(this);
+
+		// Nodes in the order they were first visited, so ties for the closest are resolved deterministically.
+		TArray<FSearchNode> Nodes;
+		TMap<FVulHexKey, int32> NodeIndices;
+		TVulIndexedPriorityQueue<int32, CostType> Frontier;
+
+		const auto Visit = [&](const FVulHexAddr& Addr, const int32 Parent, const CostType Cost, const CostType Priority)
+		{
+			auto& Index = NodeIndices.FindOrAdd(FVulHexKey(Addr), INDEX_NONE);
+
+			if (Index == INDEX_NONE)
+			{
+				Index = Nodes.Add({Addr, Parent, Cost, Priority - Cost, INDEX_NONE});
+			}
+
+			auto& Node = Nodes[Index];
+			Node.Parent = Parent;
+			Node.Cost = Cost;
+
+			if (Frontier.IsQueued(Node.FrontierHandle))
+			{
+				Frontier.Update(Node.FrontierHandle, Priority);
+			} else
+			{
+				Node.FrontierHandle = Frontier.Add(Index, Priority);
+			}
+		};
+
+		Visit(From, 0, 0, Opts.Heuristic(From, To));
+
+		while (!Frontier.IsEmpty() && Nodes.Num() < Opts.MaxVisited)
+		{
+			const auto CurrentIndex = Frontier.GetElement(Frontier.Pop());
+			const auto Current = Nodes[CurrentIndex].Addr;
+
+			if (Current == To)
+			{
+				break;
+			}
+
+			const auto& CurrentTile = TileAt(Current);
+
+			for (const auto& Offset : VulRuntime::Hexgrid::AdjacentOffsets)
+			{
+				const FVulHexAddr Next(Current.Q + Offset[0], Current.R + Offset[1]);
+				const auto Cost = Opts.CostFn(CurrentTile, TileAt(Next), this);
+
+				if (!Cost.IsSet())
+				{
+					continue;
+				}
+
+				const CostType NewCost = Nodes[CurrentIndex].Cost + Cost.GetValue();
+				const auto Existing = NodeIndices.Find(FVulHexKey(Next));
+
+				if (Existing == nullptr || NewCost < Nodes[*Existing].Cost)
+				{
+					Visit(Next, CurrentIndex, NewCost, NewCost + Opts.Heuristic(Next, To));
+				}
+			}
+		}
+
+		// Of the tiles closest to To by our heuristic, the cheapest to reach.
+		auto Closest = 0;
+
+		for (int32 Index = 1; Index < Nodes.Num(); ++Index)
+		{
+			const auto& Best = Nodes[Closest];
+			const auto& Node = Nodes[Index];
+
+			if (Best.RemainingEstimatedCost > Node.RemainingEstimatedCost
+				|| (Best.RemainingEstimatedCost == Node.RemainingEstimatedCost && Best.Cost > Node.Cost))
+			{
+				Closest = Index;
+			}
+		}
+
+		FPathResult Result;
+		Result.Complete = Nodes[Closest].Addr == To;
+		Result.Cost = Nodes[Closest].Cost;
+
+		for (auto Current = Closest; Current != 0; Current = Nodes[Current].Parent)
+		{
+			Result.Tiles.Add(TileAt(Nodes[Current].Addr));
+		}
+
+		Algo::Reverse(Result.Tiles);
+
+		return Result;
+	}
+
+private:
+	struct FChunk
+	{
+		/**
+		 * The chunk's tiles, indexed by @see LocalIndex.
+		 */
+		TArray<FVulTile> Tiles;
+
+		/**
+		 * True if any tile may differ from what the allocator or pager would provide.
+		 */
+		bool Modified = false;
+
+		uint64 LastUsed = 0;
+	};
+
+	struct FSearchNode
+	{
+		FVulHexAddr Addr;
+
+		/**
+		 * Index of the node this was reached from. The start node is its own parent.
+		 */
+		int32 Parent;
+
+		CostType Cost;
+		CostType RemainingEstimatedCost;
+		int32 FrontierHandle;
+	};
+
+	/**
+	 * Defers evicting chunks until the outermost query completes, so tiles it holds references to
+	 * stay loaded.
+	 */
+	struct FQueryScope
+	{
+		explicit FQueryScope(const TVulChunkedHexgrid* InGrid) : Grid(InGrid)
+		{
+			++Grid->QueryDepth;
+		}
+
+		~FQueryScope()
+		{
+			if (--Grid->QueryDepth == 0)
+			{
+				Grid->EvictOverBudget();
+			}
+		}
+
+	private:
+		const TVulChunkedHexgrid* Grid;
+	};
+
+	static FORCEINLINE int FloorDiv(const int Numerator, const int Denominator)
+	{
+		return Numerator >= 0 ? Numerator / Denominator : -((-Numerator + Denominator - 1) / Denominator);
+	}
+
+	FORCEINLINE int32 LocalIndex(const FVulHexAddr& Addr) const
+	{
+		return (Addr.Q - FloorDiv(Addr.Q, ChunkSize) * ChunkSize) + (Addr.R - FloorDiv(Addr.R, ChunkSize) * ChunkSize) * ChunkSize;
+	}
+
+	/**
+	 * Returns the chunk at ChunkCoord, loading it if needed, and marks it as most recently used.
+	 */
+	FChunk& Chunk(const FIntPoint& ChunkCoord) const
+	{
+		if (LastChunk != nullptr && LastChunkCoord == ChunkCoord)
+		{
+			LastChunk->LastUsed = ++UseCounter;
+			return *LastChunk;
+		}
+
+		auto& Entry = Chunks.FindOrAdd(ChunkCoord);
+
+		if (!Entry.IsValid())
+		{
+			Entry = Load(ChunkCoord);
+		}
+
+		LastChunkCoord = ChunkCoord;
+		LastChunk = Entry.Get();
+		LastChunk->LastUsed = ++UseCounter;
+
+		auto& Out = *LastChunk;
+		EvictOverBudget(&Out);
+
+		return Out;
+	}
+
+	TUniquePtr<FChunk> Load(const FIntPoint& ChunkCoord) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE_STR("VulHexgrid::LoadChunk")
+
+		auto Out = MakeUnique<FChunk>();
+		Out->Tiles.Reserve(ChunkSize * ChunkSize);
+
+		TArray<TileData> Paged;
+		const auto IsPaged = Pager.Load && Pager.Load(ChunkCoord, Paged);
+
+		ensureMsgf(
+			!IsPaged || Paged.Num() == ChunkSize * ChunkSize,
+			TEXT("Paged hexgrid chunk (%d, %d) has the wrong number of tiles"),
+			ChunkCoord.X,
+			ChunkCoord.Y
+		);
+
+		for (int32 R = 0; R < ChunkSize; ++R)
+		{
+			for (int32 Q = 0; Q < ChunkSize; ++Q)
+			{
+				const FVulHexAddr Addr(ChunkCoord.X * ChunkSize + Q, ChunkCoord.Y * ChunkSize + R);
+				const auto Index = Out->Tiles.Num();
+
+				Out->Tiles.Add(FVulTile(Addr, IsPaged && Paged.IsValidIndex(Index) ? Paged[Index] : Allocator(Addr)));
+			}
+		}
+
+		return Out;
+	}
+
+	bool PageOut(const FIntPoint& ChunkCoord, FChunk& ToSave) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE_STR("VulHexgrid::PageOutChunk")
+
+		TArray<TileData> Data;
+		Data.Reserve(ToSave.Tiles.Num());
+
+		for (const auto& Tile : ToSave.Tiles)
+		{
+			Data.Add(Tile.Data);
+		}
+
+		if (!ensureMsgf(Pager.Save(ChunkCoord, Data), TEXT("Failed to page out hexgrid chunk (%d, %d)"), ChunkCoord.X, ChunkCoord.Y))
+		{
+			return false;
+		}
+
+		ToSave.Modified = false;
+		return true;
+	}
+
+	/**
+	 * Evicts least recently used chunks until within budget, unless a query is in progress.
+	 *
+	 * Modified chunks are paged out first, and are kept if they cannot be. Keep is never evicted, so
+	 * the chunk being returned survives even when every older chunk is kept.
+	 */
+	void EvictOverBudget(const FChunk* Keep = nullptr) const
+	{
+		if (QueryDepth > 0 || Chunks.Num() <= MaxResidentChunks)
+		{
+			return;
+		}
+
+		TRACE_CPUPROFILER_EVENT_SCOPE_STR("VulHexgrid::EvictChunks")
+
+		TArray<TPair<uint64, FIntPoint>> ByAge;
+		ByAge.Reserve(Chunks.Num());
+
+		for (const auto& Entry : Chunks)
+		{
+			ByAge.Add({Entry.Value->LastUsed, Entry.Key});
+		}
+
+		Algo::SortBy(ByAge, [](const TPair<uint64, FIntPoint>& Entry) { return Entry.Key; });
+
+		for (const auto& Entry : ByAge)
+		{
+			if (Chunks.Num() <= MaxResidentChunks)
+			{
+				break;
+			}
+
+			auto& Evicting = *Chunks[Entry.Value];
+
+			if (&Evicting == Keep)
+			{
+				continue;
+			}
+
+			if (Evicting.Modified && !(Pager.Save && PageOut(Entry.Value, Evicting)))
+			{
+				continue;
+			}
+
+			if (LastChunk == &Evicting)
+			{
+				LastChunk = nullptr;
+			}
+
+			Chunks.Remove(Entry.Value);
+		}
+	}
+
+	int32 ChunkSize;
+	int32 MaxResidentChunks = 0;
+
+	FVulTileAllocator Allocator;
+	FChunkPager Pager;
+
+	/**
+	 * Chunks are held by pointer so tile references survive other chunks being added or removed.
+	 */
+	mutable TMap<FIntPoint, TUniquePtr<FChunk>> Chunks;
+	mutable uint64 UseCounter = 0;
+	mutable int32 QueryDepth = 0;
+
+	/**
+	 * The most recently used chunk, which most lookups hit as neighbouring tiles share a chunk.
+	 */
+	mutable FIntPoint LastChunkCoord;
+	mutable FChunk* LastChunk = nullptr;
+};
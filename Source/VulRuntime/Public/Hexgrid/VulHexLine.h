@@ -0,0 +1,107 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "VulHexAddr.h"
+#include "VulHexUtil.h"
+
+/**
+ * The tiles along a straight line between two tiles, computed with integer arithmetic only.
+ *
+ * Equivalent to sampling the line between the tiles' centers once per step in world space and
+ * deprojecting each sample (@see VulRuntime::Hexgrid::Project, Deproject), but without the cost
+ * of the float math or its rounding error. Samples that fall exactly on a tile boundary resolve
+ * consistently, towards positive R then positive Q.
+ *
+ * Tiles are generated on demand, so walking a line does not allocate.
+ */
+struct FVulHexLine
+{
+	FVulHexLine(const FVulHexAddr& InFrom, const FVulHexAddr& InTo)
+		: From(InFrom), DQ(InTo.Q - InFrom.Q), DR(InTo.R - InFrom.R), Steps(InFrom.Distance(InTo)) {}
+
+	/**
+	 * The number of steps from start to end, i.e. the distance between them. The line has Num() + 1 tiles.
+	 */
+	FORCEINLINE int Num() const
+	{
+		return Steps;
+	}
+
+	/**
+	 * Returns the tile at Step along the line, from 0 (the start) to Num() (the end).
+	 */
+	FORCEINLINE FVulHexAddr At(const int Step) const
+	{
+		if (Steps == 0)
+		{
+			return From;
+		}
+
+		// Work in units of 1/Steps of a tile so every sample is an integer.
+		const auto RN = From.R * Steps + DR * Step;
+		const auto QN = From.Q * Steps + DQ * Step;
+
+		// Deproject rounds R, then rounds Q after correcting for the rounded R's offset.
+		const auto R = FloorDiv(2 * RN + Steps, 2 * Steps);
+		const auto Q = FloorDiv(2 * QN + RN - R * Steps + Steps, 2 * Steps);
+
+		return FVulHexAddr(Q, R);
+	}
+
+	/**
+	 * Returns the tiles either side of the line at Step, for lines that pass within Leeway of a tile
+	 * boundary there. Leeway is a fraction of a single hex tile's size.
+	 *
+	 * These are the tiles a line may go through instead of At(Step) if that is blocked. This is done
+	 * in world space, so is much slower than At.
+	 */
+	TArray<FVulHexAddr> Alternates(const int Step, const float Leeway) const
+	{
+		FVulWorldHexGridSettings Settings;
+		Settings.HexSize = 10;
+
+		const auto Sides = FVulMath::EitherSideOfLine(
+			VulRuntime::Hexgrid::Project(From, Settings),
+			VulRuntime::Hexgrid::Project(FVulHexAddr(From.Q + DQ, From.R + DR), Settings),
+			Step / static_cast<float>(Steps),
+			Settings.ProjectionPlane.GetNormal(),
+			Settings.HexSize * Leeway
+		);
+
+		TArray<FVulHexAddr> Out;
+
+		for (const auto& Side : Sides)
+		{
+			Out.Add(VulRuntime::Hexgrid::Deproject(Side, Settings));
+		}
+
+		return Out;
+	}
+
+	/**
+	 * All tiles along the line, including start and end.
+	 */
+	TArray<FVulHexAddr> ToArray() const
+	{
+		TArray<FVulHexAddr> Out;
+		Out.Reserve(Steps + 1);
+
+		for (int Step = 0; Step <= Steps; ++Step)
+		{
+			Out.Add(At(Step));
+		}
+
+		return Out;
+	}
+
+private:
+	static FORCEINLINE int FloorDiv(const int Numerator, const int Denominator)
+	{
+		return Numerator >= 0 ? Numerator / Denominator : -((-Numerator + Denominator - 1) / Denominator);
+	}
+
+	FVulHexAddr From;
+	int DQ;
+	int DR;
+	int Steps;
+};
@@ -0,0 +1,243 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "VulHexAddr.h"
+
+/**
+ * The addresses in a ring of hexes Radius tiles from Center, for range-based for loops.
+ *
+ * Yields the same addresses in the same order as @see FVulHexAddr::GenerateRing (translated to
+ * Center) without allocating. A radius of 0 yields Center only.
+ *
+ *   for (const auto Addr : FVulHexRing(Center, 2)) { ... }
+ */
+struct FVulHexRing
+{
+	FVulHexRing(const FVulHexAddr& InCenter, const int InRadius) : Center(InCenter), Radius(InRadius)
+	{
+		checkf(Radius >= 0, TEXT("Hex ring radius must not be negative"))
+	}
+
+	struct FIterator
+	{
+		FORCEINLINE FVulHexAddr operator*() const
+		{
+			return FVulHexAddr(Q, R);
+		}
+
+		FORCEINLINE FIterator& operator++()
+		{
+			const auto& Direction = VulRuntime::Hexgrid::AdjacentOffsets[(Side + 2) % 6];
+			Q += Direction[0];
+			R += Direction[1];
+
+			if (++Step == Radius)
+			{
+				Step = 0;
+				++Side;
+			}
+
+			--Remaining;
+			return *this;
+		}
+
+		FORCEINLINE bool operator!=(const FIterator& Other) const
+		{
+			return Remaining != Other.Remaining;
+		}
+
+	private:
+		friend struct FVulHexRing;
+
+		int Q = 0;
+		int R = 0;
+		int Radius = 0;
+		int Side = 0;
+		int Step = 0;
+		int32 Remaining = 0;
+	};
+
+	FORCEINLINE FIterator begin() const
+	{
+		FIterator It;
+		It.Q = Center.Q + VulRuntime::Hexgrid::AdjacentOffsets[0][0] * Radius;
+		It.R = Center.R + VulRuntime::Hexgrid::AdjacentOffsets[0][1] * Radius;
+		It.Radius = Radius;
+		It.Remaining = Num();
+		return It;
+	}
+
+	FORCEINLINE FIterator end() const
+	{
+		return FIterator();
+	}
+
+	/**
+	 * The number of addresses in this ring.
+	 */
+	FORCEINLINE int32 Num() const
+	{
+		return Radius == 0 ? 1 : Radius * 6;
+	}
+
+private:
+	FVulHexAddr Center;
+	int Radius;
+};
+
+/**
+ * The addresses within Radius tiles of Center as a series of rings expanding outwards, for range-based
+ * for loops.
+ *
+ * Yields the same addresses in the same order as @see FVulHexAddr::GenerateGrid (translated to
+ * Center) without allocating, so nearer tiles always come first.
+ */
+struct FVulHexSpiral
+{
+	FVulHexSpiral(const FVulHexAddr& InCenter, const int InRadius) : Center(InCenter), Radius(InRadius)
+	{
+		checkf(Radius >= 0, TEXT("Hex spiral radius must not be negative"))
+	}
+
+	struct FIterator
+	{
+		FORCEINLINE FVulHexAddr operator*() const
+		{
+			return *Ring;
+		}
+
+		FORCEINLINE FIterator& operator++()
+		{
+			++Ring;
+
+			if (!(Ring != FVulHexRing::FIterator()) && --Remaining > 0)
+			{
+				Ring = FVulHexRing(Center, ++Radius).begin();
+			}
+
+			return *this;
+		}
+
+		FORCEINLINE bool operator!=(const FIterator& Other) const
+		{
+			return Remaining != Other.Remaining;
+		}
+
+	private:
+		friend struct FVulHexSpiral;
+
+		FVulHexAddr Center;
+		FVulHexRing::FIterator Ring;
+		int Radius = 0;
+
+		/**
+		 * The number of rings left, including the current one.
+		 */
+		int32 Remaining = 0;
+	};
+
+	FORCEINLINE FIterator begin() const
+	{
+		FIterator It;
+		It.Center = Center;
+		It.Ring = FVulHexRing(Center, 0).begin();
+		It.Remaining = Radius + 1;
+		return It;
+	}
+
+	FORCEINLINE FIterator end() const
+	{
+		return FIterator();
+	}
+
+	/**
+	 * The number of addresses in this spiral.
+	 */
+	FORCEINLINE int32 Num() const
+	{
+		return 3 * Radius * (Radius + 1) + 1;
+	}
+
+private:
+	FVulHexAddr Center;
+	int Radius;
+};
+
+/**
+ * The addresses within Radius tiles of Center in no particular order, for range-based for loops.
+ *
+ * Cheaper to step through than an @see FVulHexSpiral, so prefer this when the order of tiles does
+ * not matter.
+ */
+struct FVulHexRange
+{
+	FVulHexRange(const FVulHexAddr& InCenter, const int InRadius) : Center(InCenter), Radius(InRadius)
+	{
+		checkf(Radius >= 0, TEXT("Hex range radius must not be negative"))
+	}
+
+	struct FIterator
+	{
+		FORCEINLINE FVulHexAddr operator*() const
+		{
+			return FVulHexAddr(CenterQ + DQ, CenterR + DR);
+		}
+
+		FORCEINLINE FIterator& operator++()
+		{
+			// Each column of constant Q covers R in [max(-N, -Q-N), min(N, -Q+N)].
+			if (++DR > FMath::Min(Radius, -DQ + Radius))
+			{
+				++DQ;
+				DR = FMath::Max(-Radius, -DQ - Radius);
+			}
+
+			--Remaining;
+			return *this;
+		}
+
+		FORCEINLINE bool operator!=(const FIterator& Other) const
+		{
+			return Remaining != Other.Remaining;
+		}
+
+	private:
+		friend struct FVulHexRange;
+
+		int CenterQ = 0;
+		int CenterR = 0;
+		int Radius = 0;
+		int DQ = 0;
+		int DR = 0;
+		int32 Remaining = 0;
+	};
+
+	FORCEINLINE FIterator begin() const
+	{
+		FIterator It;
+		It.CenterQ = Center.Q;
+		It.CenterR = Center.R;
+		It.Radius = Radius;
+		It.DQ = -Radius;
+		It.DR = 0;
+		It.Remaining = Num();
+		return It;
+	}
+
+	FORCEINLINE FIterator end() const
+	{
+		return FIterator();
+	}
+
+	/**
+	 * The number of addresses in this range.
+	 */
+	FORCEINLINE int32 Num() const
+	{
+		return 3 * Radius * (Radius + 1) + 1;
+	}
+
+private:
+	FVulHexAddr Center;
+	int Radius;
+};
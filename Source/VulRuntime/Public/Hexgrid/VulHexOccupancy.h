@@ -0,0 +1,364 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "VulHexAddr.h"
+#include "VulHexNeighbourhood.h"
+#include "VulHexUtil.h"
+
+/**
+ * An index of what occupies each tile of a hexgrid, e.g. units or actors, for answering which
+ * occupants are at a tile or within range of it without scanning every occupant.
+ *
+ * Kept alongside a grid such as @see TVulHexgrid, rather than in its tile data, so occupants can
+ * move without touching the grid (and invalidating its path caches). A tile may have any number of
+ * occupants and adding, moving and removing an occupant are constant time.
+ *
+ * OccupantType identifies an occupant, so must be hashable, e.g. an ID, a pointer or a
+ * TObjectKey<AActor>. Each occupant is on at most one tile.
+ *
+ * This is not threadsafe.
+ */
+template <typename OccupantType>
+struct TVulHexOccupancy
+{
+	/**
+	 * Places Occupant at Addr, moving it if it is already in this index.
+	 */
+	void Add(const OccupantType& Occupant, const FVulHexAddr& Addr)
+	{
+		if (const auto Existing = Slots.Find(Occupant))
+		{
+			Relink(*Existing, Addr);
+			return;
+		}
+
+		int32 Slot;
+
+		if (FreeSlot != INDEX_NONE)
+		{
+			Slot = FreeSlot;
+			FreeSlot = Entries[Slot].Next;
+			Entries[Slot].Occupant = Occupant;
+		} else
+		{
+			Slot = Entries.Add({Occupant});
+		}
+
+		Slots.Add(Occupant, Slot);
+		Link(Slot, Addr);
+	}
+
+	/**
+	 * Moves Occupant to Addr. Returns false if Occupant is not in this index.
+	 */
+	bool Move(const OccupantType& Occupant, const FVulHexAddr& Addr)
+	{
+		const auto Slot = Slots.Find(Occupant);
+
+		if (Slot == nullptr)
+		{
+			return false;
+		}
+
+		Relink(*Slot, Addr);
+		return true;
+	}
+
+	/**
+	 * Removes Occupant from this index. Returns false if it was not in it.
+	 */
+	bool Remove(const OccupantType& Occupant)
+	{
+		int32 Slot;
+
+		if (!Slots.RemoveAndCopyValue(Occupant, Slot))
+		{
+			return false;
+		}
+
+		Unlink(Slot);
+
+		// Release the occupant, in case it holds a reference.
+		Entries[Slot].Occupant = OccupantType();
+		Entries[Slot].Next = FreeSlot;
+		FreeSlot = Slot;
+
+		return true;
+	}
+
+	void Reset()
+	{
+		Entries.Reset();
+		Slots.Reset();
+		Tiles.Reset();
+		FreeSlot = INDEX_NONE;
+	}
+
+	/**
+	 * Returns the tile Occupant is on, if it's in this index.
+	 */
+	TOptional<FVulHexAddr> Find(const OccupantType& Occupant) const
+	{
+		if (const auto Slot = Slots.Find(Occupant))
+		{
+			return Entries[*Slot].Addr;
+		}
+
+		return {};
+	}
+
+	bool Contains(const OccupantType& Occupant) const
+	{
+		return Slots.Contains(Occupant);
+	}
+
+	/**
+	 * The number of occupants in this index.
+	 */
+	int32 Num() const
+	{
+		return Slots.Num();
+	}
+
+	/**
+	 * The number of occupants at Addr.
+	 */
+	int32 NumAt(const FVulHexAddr& Addr) const
+	{
+		const auto Tile = Tiles.Find(FVulHexKey(Addr));
+		return Tile != nullptr ? Tile->Num : 0;
+	}
+
+	bool IsOccupied(const FVulHexAddr& Addr) const
+	{
+		return Tiles.Contains(FVulHexKey(Addr));
+	}
+
+	/**
+	 * Invokes Fn with each occupant at Addr, in the order they arrived at it.
+	 *
+	 * Occupants must not be added, moved or removed during iteration.
+	 */
+	template <typename FnType>
+	void ForEachAt(const FVulHexAddr& Addr, const FnType& Fn) const
+	{
+		if (const auto Tile = Tiles.Find(FVulHexKey(Addr)))
+		{
+			for (auto Slot = Tile->Head; Slot != INDEX_NONE; Slot = Entries[Slot].Next)
+			{
+				Fn(Entries[Slot].Occupant);
+			}
+		}
+	}
+
+	TArray<OccupantType> GetAt(const FVulHexAddr& Addr) const
+	{
+		TArray<OccupantType> Out;
+		Out.Reserve(NumAt(Addr));
+		ForEachAt(Addr, [&Out](const OccupantType& Occupant) { Out.Add(Occupant); });
+		return Out;
+	}
+
+	/**
+	 * Invokes Fn(Occupant, Addr) with each occupant within Range of Center, closest tiles first.
+	 *
+	 * Occupants must not be added, moved or removed during iteration.
+	 */
+	template <typename FnType>
+	void ForEachInRange(const FVulHexAddr& Center, const int Range, const FnType& Fn) const
+	{
+		if (Tiles.IsEmpty())
+		{
+			return;
+		}
+
+		for (const auto Addr : FVulHexSpiral(Center, Range))
+		{
+			ForEachAt(Addr, [&](const OccupantType& Occupant) { Fn(Occupant, Addr); });
+		}
+	}
+
+	/**
+	 * Invokes Fn(Occupant, Addr) with each occupant exactly Radius from Center.
+	 */
+	template <typename FnType>
+	void ForEachInRing(const FVulHexAddr& Center, const int Radius, const FnType& Fn) const
+	{
+		if (Tiles.IsEmpty())
+		{
+			return;
+		}
+
+		for (const auto Addr : FVulHexRing(Center, Radius))
+		{
+			ForEachAt(Addr, [&](const OccupantType& Occupant) { Fn(Occupant, Addr); });
+		}
+	}
+
+	/**
+	 * Returns the occupants within Range of Center, closest first.
+	 */
+	TArray<OccupantType> GetInRange(const FVulHexAddr& Center, const int Range) const
+	{
+		TArray<OccupantType> Out;
+		ForEachInRange(Center, Range, [&Out](const OccupantType& Occupant, const FVulHexAddr&) { Out.Add(Occupant); });
+		return Out;
+	}
+
+	/**
+	 * Sets how world locations map on to tiles for @see UpdateWorldLocation, e.g. with the location
+	 * from AVulHexgridSpawn::GetSpawnLocation as GridOrigin.
+	 */
+	void SetWorldProjection(const FVulWorldHexGridSettings& InSettings, const FVector& InGridOrigin = FVector::ZeroVector)
+	{
+		Settings = InSettings;
+		GridOrigin = InGridOrigin;
+		// Deproject rounds R then Q, so maps a ShortStep by LongStep / 2 rectangle around each center to
+		// its tile. This is the largest circle within it.
+		InnerRadiusSquared = FMath::Square(FMath::Min(Settings.GetValue().ShortStep(), Settings.GetValue().LongStep() / 2));
+
+		for (auto& Entry : Entries)
+		{
+			Entry.WorldCenter = WorldCenterOf(Entry.Addr);
+		}
+	}
+
+	/**
+	 * Places Occupant on the tile under WorldLocation, adding it if needed. Suitable for calling
+	 * every frame for moving actors.
+	 *
+	 * Requires @see SetWorldProjection. The tile is only deprojected once Occupant leaves a circle
+	 * around its current tile's center, so an occupant that stays near it costs a distance check.
+	 *
+	 * Returns true if Occupant changed tile.
+	 */
+	bool UpdateWorldLocation(const OccupantType& Occupant, const FVector& WorldLocation)
+	{
+		checkf(Settings.IsSet(), TEXT("Hexgrid occupancy requires SetWorldProjection before updating world locations"))
+
+		const auto Slot = Slots.Find(Occupant);
+
+		if (Slot != nullptr && FVector::DistSquared2D(WorldLocation, Entries[*Slot].WorldCenter) < InnerRadiusSquared)
+		{
+			return false;
+		}
+
+		const auto Addr = VulRuntime::Hexgrid::Deproject(WorldLocation, Settings.GetValue(), GridOrigin);
+
+		if (Slot != nullptr && Entries[*Slot].Addr == Addr)
+		{
+			return false;
+		}
+
+		Add(Occupant, Addr);
+		return true;
+	}
+
+private:
+	struct FEntry
+	{
+		OccupantType Occupant;
+		FVulHexAddr Addr;
+
+		/**
+		 * The world location of Addr's center, if a world projection is set.
+		 */
+		FVector WorldCenter = FVector::ZeroVector;
+
+		/**
+		 * Neighbouring occupants on the same tile. Next links free slots once removed.
+		 */
+		int32 Prev = INDEX_NONE;
+		int32 Next = INDEX_NONE;
+	};
+
+	/**
+	 * The occupants of a tile, as a list through Entries.
+	 */
+	struct FTile
+	{
+		int32 Head = INDEX_NONE;
+		int32 Tail = INDEX_NONE;
+		int32 Num = 0;
+	};
+
+	FVector WorldCenterOf(const FVulHexAddr& Addr) const
+	{
+		return Settings.IsSet() ? VulRuntime::Hexgrid::Project(Addr, Settings.GetValue()) + GridOrigin : FVector::ZeroVector;
+	}
+
+	void Link(const int32 Slot, const FVulHexAddr& Addr)
+	{
+		auto& Entry = Entries[Slot];
+		auto& Tile = Tiles.FindOrAdd(FVulHexKey(Addr));
+
+		Entry.Addr = Addr;
+		Entry.WorldCenter = WorldCenterOf(Addr);
+		Entry.Prev = Tile.Tail;
+		Entry.Next = INDEX_NONE;
+
+		if (Tile.Tail != INDEX_NONE)
+		{
+			Entries[Tile.Tail].Next = Slot;
+		} else
+		{
+			Tile.Head = Slot;
+		}
+
+		Tile.Tail = Slot;
+		++Tile.Num;
+	}
+
+	void Unlink(const int32 Slot)
+	{
+		const auto& Entry = Entries[Slot];
+		const FVulHexKey Key(Entry.Addr);
+		auto& Tile = Tiles.FindChecked(Key);
+
+		if (Entry.Prev != INDEX_NONE)
+		{
+			Entries[Entry.Prev].Next = Entry.Next;
+		} else
+		{
+			Tile.Head = Entry.Next;
+		}
+
+		if (Entry.Next != INDEX_NONE)
+		{
+			Entries[Entry.Next].Prev = Entry.Prev;
+		} else
+		{
+			Tile.Tail = Entry.Prev;
+		}
+
+		// Only occupied tiles are kept, so the index's size follows the number of occupants.
+		if (--Tile.Num == 0)
+		{
+			Tiles.Remove(Key);
+		}
+	}
+
+	void Relink(const int32 Slot, const FVulHexAddr& Addr)
+	{
+		if (Entries[Slot].Addr == Addr)
+		{
+			return;
+		}
+
+		Unlink(Slot);
+		Link(Slot, Addr);
+	}
+
+	/**
+	 * Per-occupant state, indexed by slot. Removed occupants' slots are reused.
+	 */
+	TArray<FEntry> Entries;
+	int32 FreeSlot = INDEX_NONE;
+
+	TMap<OccupantType, int32> Slots;
+	TMap<FVulHexKey, FTile> Tiles;
+
+	TOptional<FVulWorldHexGridSettings> Settings;
+	FVector GridOrigin = FVector::ZeroVector;
+	double InnerRadiusSquared = 0;
+};
@@ -0,0 +1,196 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "VulHexAddr.h"
+#include "VulHexgridLayout.h"
+
+/**
+ * A set of hex addresses stored as one bit per index of a layout, e.g. a zone of control, an area of
+ * effect or a deployment area on a grid.
+ *
+ * Membership checks are a bit lookup, and set algebra and dilation work on 64 tiles at a time, so prefer
+ * this to arrays of addresses that are repeatedly searched with Contains.
+ *
+ * Only addresses within the layout can be in the region. Regions combined with each other must share
+ * the same layout; @see TVulHexgrid::TileRegion and related queries produce regions laid out like their
+ * grid, which stay valid until the grid is re-laid out.
+ */
+struct VULRUNTIME_API FVulHexRegion
+{
+	FVulHexRegion() = default;
+	explicit FVulHexRegion(const FVulHexgridLayout& InLayout);
+
+	/**
+	 * A region of every address in InLayout.
+	 */
+	static FVulHexRegion Full(const FVulHexgridLayout& InLayout);
+
+	/**
+	 * Adds Addr, returning false if it is outside this region's layout.
+	 */
+	bool Add(const FVulHexAddr& Addr);
+
+	void Remove(const FVulHexAddr& Addr);
+
+	FORCEINLINE bool Contains(const FVulHexAddr& Addr) const
+	{
+		return ContainsIndex(Layout.IndexOf(Addr));
+	}
+
+	/**
+	 * True if the layout index is in this region. INDEX_NONE is never in a region.
+	 */
+	FORCEINLINE bool ContainsIndex(const int32 Index) const
+	{
+		return static_cast<uint32>(Index) < static_cast<uint32>(Layout.Num())
+			&& (Words[Index / 64] >> (Index % 64) & 1) != 0;
+	}
+
+	FORCEINLINE void AddIndex(const int32 Index)
+	{
+		checkf(Index >= 0 && Index < Layout.Num(), TEXT("Index %d is outside this region's layout"), Index)
+		Words[Index / 64] |= uint64(1) << (Index % 64);
+	}
+
+	FORCEINLINE void RemoveIndex(const int32 Index)
+	{
+		checkf(Index >= 0 && Index < Layout.Num(), TEXT("Index %d is outside this region's layout"), Index)
+		Words[Index / 64] &= ~(uint64(1) << (Index % 64));
+	}
+
+	/**
+	 * The number of addresses in this region.
+	 */
+	int32 Num() const;
+
+	bool IsEmpty() const;
+
+	/**
+	 * Removes all addresses, keeping the layout.
+	 */
+	void Reset();
+
+	/**
+	 * Adds every address in Other to this region.
+	 */
+	FVulHexRegion& Union(const FVulHexRegion& Other);
+
+	/**
+	 * Removes every address that is not also in Other.
+	 */
+	FVulHexRegion& Intersect(const FVulHexRegion& Other);
+
+	/**
+	 * Removes every address in Other.
+	 */
+	FVulHexRegion& Difference(const FVulHexRegion& Other);
+
+	/**
+	 * Grows this region by Rings, adding every address within Rings tiles of an address in it.
+	 *
+	 * If Within is provided, growth only spreads through its addresses, e.g. the tiles of a grid or
+	 * those that can be moved through, so this is a flood fill limited to Rings steps.
+	 */
+	FVulHexRegion& Dilate(const int Rings, const FVulHexRegion* Within = nullptr);
+
+	FVulHexRegion operator|(const FVulHexRegion& Other) const { return FVulHexRegion(*this).Union(Other); }
+	FVulHexRegion operator&(const FVulHexRegion& Other) const { return FVulHexRegion(*this).Intersect(Other); }
+	FVulHexRegion operator-(const FVulHexRegion& Other) const { return FVulHexRegion(*this).Difference(Other); }
+
+	bool operator==(const FVulHexRegion& Other) const
+	{
+		return Layout == Other.Layout && Words == Other.Words;
+	}
+
+	bool operator!=(const FVulHexRegion& Other) const
+	{
+		return !(*this == Other);
+	}
+
+	/**
+	 * The region's addresses in layout order.
+	 */
+	TArray<FVulHexAddr> GetAddrs() const;
+
+	/**
+	 * Invokes Fn with the layout index of each address in this region, in layout order.
+	 */
+	template <typename FnType>
+	void ForEachIndex(const FnType& Fn) const
+	{
+		for (int32 Word = 0; Word < Words.Num(); ++Word)
+		{
+			for (auto Bits = Words[Word]; Bits != 0; Bits &= Bits - 1)
+			{
+				Fn(Word * 64 + static_cast<int32>(FMath::CountTrailingZeros64(Bits)));
+			}
+		}
+	}
+
+	/**
+	 * Steps through the region's addresses in layout order, for range-based for loops.
+	 */
+	struct FIterator
+	{
+		FORCEINLINE FVulHexAddr operator*() const
+		{
+			return Region->Layout.AddrOf(Word * 64 + static_cast<int32>(FMath::CountTrailingZeros64(Bits)));
+		}
+
+		FORCEINLINE FIterator& operator++()
+		{
+			Bits &= Bits - 1;
+			SkipEmptyWords();
+			return *this;
+		}
+
+		FORCEINLINE bool operator!=(const FIterator& Other) const
+		{
+			return Word != Other.Word || Bits != Other.Bits;
+		}
+
+	private:
+		friend struct FVulHexRegion;
+
+		FORCEINLINE void SkipEmptyWords()
+		{
+			while (Bits == 0 && ++Word < Region->Words.Num())
+			{
+				Bits = Region->Words[Word];
+			}
+		}
+
+		const FVulHexRegion* Region = nullptr;
+		int32 Word = 0;
+		uint64 Bits = 0;
+	};
+
+	FIterator begin() const
+	{
+		FIterator It;
+		It.Region = this;
+		It.Word = -1;
+		It.SkipEmptyWords();
+		return It;
+	}
+
+	FIterator end() const
+	{
+		FIterator It;
+		It.Region = this;
+		It.Word = Words.Num();
+		return It;
+	}
+
+	const FVulHexgridLayout& GetLayout() const { return Layout; }
+
+private:
+	FVulHexgridLayout Layout;
+
+	/**
+	 * One bit per layout index. Bits beyond the end of the layout are always clear.
+	 */
+	TArray<uint64> Words;
+
+	void CheckSameLayout(const FVulHexRegion& Other) const;
+};
@@ -61,6 +61,92 @@ struct FVulWorldHexGridSettings
 	float LongStep() const;
 };
 
+/**
+ * Projects many tiles between hexgrid and world space at once, for building meshes of, or picking
+ * tiles from, large grids.
+ *
+ * Constants derived from FVulWorldHexGridSettings are computed once on construction. Results are
+ * written to caller-provided structure-of-arrays buffers (separate X and Y spans; Z is always 0, as
+ * per @see VulRuntime::Hexgrid::Project), which must be at least as large as documented for each
+ * function. Each function is a single branch-free loop over its inputs, which compilers vectorise.
+ *
+ * Results are identical to the equivalent per-tile functions in VulRuntime::Hexgrid.
+ */
+struct VULRUNTIME_API FVulHexProjection
+{
+	typedef FVector::FReal FReal;
+
+	/**
+	 * The number of vertices and indices per tile written by @see TriangleMesh.
+	 */
+	static constexpr int32 VerticesPerTile = 7;
+	static constexpr int32 IndicesPerTile = 18;
+
+	explicit FVulHexProjection(const FVulWorldHexGridSettings& GridSettings);
+
+	/**
+	 * Writes the center of each of Addrs, as per @see VulRuntime::Hexgrid::Project.
+	 *
+	 * OutX and OutY must have room for Addrs.Num() entries.
+	 */
+	void Project(TConstArrayView<FVulHexAddr> Addrs, TArrayView<FReal> OutX, TArrayView<FReal> OutY) const;
+
+	/**
+	 * Writes the 6 corners of each of Addrs, as per @see VulRuntime::Hexgrid::Points. The corners of
+	 * Addrs[I] are at I * 6 to I * 6 + 5.
+	 *
+	 * OutX and OutY must have room for Addrs.Num() * 6 entries.
+	 */
+	void Points(
+		TConstArrayView<FVulHexAddr> Addrs,
+		TArrayView<FReal> OutX,
+		TArrayView<FReal> OutY,
+		const float Scale = 1
+	) const;
+
+	/**
+	 * Writes an indexed triangle mesh of Addrs: the 6 triangles of each tile as per
+	 * @see VulRuntime::Hexgrid::Triangles, sharing vertices within a tile.
+	 *
+	 * Each tile has VerticesPerTile vertices, its center then its corners, and IndicesPerTile indices.
+	 * OutX and OutY must have room for Addrs.Num() * VerticesPerTile entries and OutIndices room for
+	 * Addrs.Num() * IndicesPerTile. BaseVertex is added to every index, for appending to a larger mesh.
+	 */
+	void TriangleMesh(
+		TConstArrayView<FVulHexAddr> Addrs,
+		TArrayView<FReal> OutX,
+		TArrayView<FReal> OutY,
+		TArrayView<int32> OutIndices,
+		const float Scale = 1,
+		const int32 BaseVertex = 0
+	) const;
+
+	/**
+	 * Writes the tile each world point (X[I], Y[I]) sits within, as per @see VulRuntime::Hexgrid::Deproject.
+	 *
+	 * X and Y must be the same length and Out must have room for as many entries.
+	 */
+	void Deproject(
+		TConstArrayView<FReal> X,
+		TConstArrayView<FReal> Y,
+		TArrayView<FVulHexAddr> Out,
+		const FVector& GridOrigin = FVector::ZeroVector
+	) const;
+
+private:
+	/**
+	 * As per FVulWorldHexGridSettings; kept in single precision to match the per-tile functions.
+	 */
+	float ShortStep;
+	float LongStep;
+
+	/**
+	 * Offsets from a tile's center to each of its corners, unscaled.
+	 */
+	FReal CornerX[6];
+	FReal CornerY[6];
+};
+
 namespace VulRuntime::Hexgrid
 {
 	/**
@@ -1,10 +1,20 @@
 ﻿#pragma once
 
 #include "CoreMinimal.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Unique.h"
+#include "Async/ParallelFor.h"
 #include "VulHexAddr.h"
+#include "VulHexgridLayout.h"
+#include "VulHexLine.h"
+#include "VulHexNeighbourhood.h"
+#include "VulHexRegion.h"
 #include "VulHexUtil.h"
+#include "Containers/VulIndexedPriorityQueue.h"
 #include "Containers/VulPriorityQueue.h"
 #include "Misc/VulRngManager.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
 #include "UObject/Object.h"
 
 /**
@@ -23,6 +33,14 @@
  *                   (-2 +2  0)        (-1 +2 -1)        ( 0 +2 -2)
  *
  * Templated to allow arbitrary data structures to be stored at each tile in the grid.
+ *
+ * Tiles are stored densely in a flat array, indexed via a @see FVulHexgridLayout. Tile lookups
+ * are therefore a bounds check and a multiply rather than a hash lookup. TileData must be
+ * default-constructible as layout slots that are not part of the grid hold a default value.
+ *
+ * Const queries may be made concurrently, provided the grid is not modified meanwhile and the path
+ * cache, path hierarchy and connectivity index are disabled, as queries update those. @see PathBatch
+ * runs many path queries across threads.
  */
 template <typename TileData, typename CostType = int>
 struct TVulHexgrid
@@ -50,7 +68,9 @@ struct TVulHexgrid
 	{
 		checkf(InSize > 0, TEXT("Hexgrid Size must be a greater than 0"))
 
-		for (const auto& Addr : FVulHexAddr::GenerateGrid(InSize))
+		Relayout(FVulHexgridLayout::Hexagonal(InSize));
+
+		for (const auto Addr : FVulHexSpiral(FVulHexAddr::Origin(), InSize))
 		{
 			AddTile(Addr, Allocator);
 		}
@@ -63,10 +83,27 @@ struct TVulHexgrid
 	 *
 	 * Use in construction grid-building scenarios only.
 	 * Use SetTileData to assign data to an existing grid.
+	 *
+	 * Adding a tile outside of the grid's current layout re-lays out tile storage,
+	 * invalidating any pointers previously returned by ModifyTileData.
 	 */
 	void AddTile(const FVulHexAddr& Addr, const TileData& Data)
 	{
-		Tiles.Add(Addr, FVulTile(Addr, Data));
+		if (!Layout.Contains(Addr))
+		{
+			Relayout(Layout.Expand(Addr));
+		}
+
+		const auto Index = Layout.IndexOf(Addr);
+		RecordEdit(Index);
+
+		if (!Valid[Index])
+		{
+			Valid[Index] = true;
+			++ValidCount;
+		}
+
+		Tiles[Index] = FVulTile(Addr, Data);
 	}
 
 	/**
@@ -74,7 +111,17 @@ struct TVulHexgrid
 	 */
 	void RemoveTile(const FVulHexAddr& Addr)
 	{
-		Tiles.Remove(Addr);
+		const auto Index = TileIndex(Addr);
+
+		if (Index == INDEX_NONE)
+		{
+			return;
+		}
+
+		Valid[Index] = false;
+		--ValidCount;
+		Tiles[Index] = FVulTile(Addr, TileData());
+		RecordEdit(Index);
 	}
 
 	/**
@@ -103,6 +150,29 @@ struct TVulHexgrid
 			FHeuristicFn InHeuristic = &DefaultHeuristic
 		) : CostFn(InCostFn), Heuristic(InHeuristic) {}
 
+		/**
+		 * Options where every move costs 1, but only in to tiles that are Passable.
+		 *
+		 * Path queries made with these options use a faster search specialised for uniform costs,
+		 * @see Passable.
+		 */
+		static TVulQueryOptions Uniform(const FVulTileValidFn& Passable, const FName CacheKey = NAME_None)
+		{
+			TVulQueryOptions Out([Passable](const FVulTile& From, const FVulTile& To, const TVulHexgrid* Grid) -> TOptional<CostType>
+			{
+				if (Passable(To))
+				{
+					return 1;
+				}
+
+				return {};
+			});
+
+			Out.Passable = Passable;
+			Out.CacheKey = CacheKey;
+			return Out;
+		}
+
 		/**
 		 * Given a tile From and its adjacent tile To, this function returns a cost to move between
 		 * them.
@@ -116,6 +186,24 @@ struct TVulHexgrid
 		 * Our A* pathfinding uses this to guide which routes to check out next in its search.
 		 */
 		FHeuristicFn Heuristic = &DefaultHeuristic;
+
+		/**
+		 * Identifies CostFn for the grid's path cache and path hierarchy, @see SetPathCacheCapacity and
+		 * @see SetPathHierarchy. Queries made with the same key must use equivalent cost functions.
+		 *
+		 * Queries without a key are never cached and never use the path hierarchy.
+		 */
+		FName CacheKey;
+
+		/**
+		 * Set by @see Uniform, declaring that CostFn costs 1 to move in to a tile that is Passable and
+		 * disallows moving in to any other.
+		 *
+		 * Path then evaluates Passable once per tile instead of CostFn once per move, and breaks ties
+		 * between the many equally cheap routes of a uniform grid rather than exploring them all. Heuristic
+		 * is not used. Results are as cheap as a regular search's.
+		 */
+		FVulTileValidFn Passable;
 	};
 
 	struct FTraceResult
@@ -163,62 +251,153 @@ struct TVulHexgrid
 	) const {
 		TRACE_CPUPROFILER_EVENT_SCOPE_STR("VulHexgrid::Trace")
 
-		FVulWorldHexGridSettings Settings;
-		Settings.HexSize = 10;
+		FTraceResult Result;
+		Result.Complete = WalkLine(From, To, Leeway, [&](const int32 Index) { return Check(Tiles[Index]); }, &Result.Tiles);
+		return Result;
+	}
 
-		const auto Start = VulRuntime::Hexgrid::Project(From, Settings);
-		const auto End = VulRuntime::Hexgrid::Project(To, Settings);
-		const auto LineSegment = End - Start;
-		const auto SampleCount = From.Distance(To);
+	/**
+	 * Returns every tile within Range of Origin that is visible from it, i.e. each tile for which
+	 * Trace(Origin, Tile, Check, Leeway) would be complete. This includes Origin itself.
+	 *
+	 * Cheaper than a Trace per tile as Check is evaluated at most once per tile.
+	 */
+	TArray<FVulHexAddr> FieldOfView(
+		const FVulHexAddr& Origin,
+		const int Range,
+		const FVulTileValidFn& Check = [](const FVulTile&) { return true; },
+		const float Leeway = 0.01
+	) const {
+		TRACE_CPUPROFILER_EVENT_SCOPE_STR("VulHexgrid::FieldOfView")
 
-		FTraceResult Result;
-		Result.Tiles.Add(From);
+		TArray<FVulHexAddr> Out;
 
-		for (auto SampleN = 1; SampleN <= SampleCount; ++SampleN)
+		if (!IsValidAddr(Origin))
 		{
-			const auto Sample = Start + LineSegment * (SampleN / static_cast<float>(SampleCount));
-			auto Tile = VulRuntime::Hexgrid::Deproject(Sample, Settings);
+			return Out;
+		}
+
+		FCachedCheck IsClear(this, Check);
 
-			if (!IsValidAddr(Tile))
+		for (const auto Target : FVulHexSpiral(Origin, Range))
+		{
+			if (IsValidAddr(Target) && WalkLine(Origin, Target, Leeway, IsClear, nullptr))
 			{
-				return Result;
+				Out.Add(Target);
 			}
+		}
+
+		return Out;
+	}
+
+	/**
+	 * Precomputed visibility between every pair of tiles within some range of each other.
+	 *
+	 * Built by @see PrecomputeVisibility for obstacles that don't change, so line of sight checks
+	 * become a lookup. This is a snapshot; it is not updated if the grid changes.
+	 */
+	struct FVisibility
+	{
+		/**
+		 * True if To is visible from From, as per Trace. Tiles further apart than the range the
+		 * visibility was computed for are never visible.
+		 */
+		bool IsVisible(const FVulHexAddr& From, const FVulHexAddr& To) const
+		{
+			const auto FromIndex = Layout.IndexOf(From);
 
-			if (!Check(GetTile(Tile).GetValue()) && Leeway > 0.f)
+			if (FromIndex == INDEX_NONE || From.Distance(To) > Range)
 			{
-				const auto Sides = FVulMath::EitherSideOfLine(
-					Start,
-					End,
-					SampleN / static_cast<float>(SampleCount),
-					Settings.ProjectionPlane.GetNormal(),
-					Settings.HexSize * Leeway
-				);
+				return false;
+			}
 
-				bool AlternateFound = false;
+			return Visible[FromIndex * Window.Num() + Window.IndexOf(To.Q - From.Q, To.R - From.R)];
+		}
 
-				for (const auto& Side : Sides)
-				{
-					const auto& Candidate = VulRuntime::Hexgrid::Deproject(Side, Settings);
+		/**
+		 * All tiles visible from From, as per FieldOfView.
+		 */
+		TArray<FVulHexAddr> GetVisible(const FVulHexAddr& From) const
+		{
+			TArray<FVulHexAddr> Out;
 
-					if (IsValidAddr(Candidate) && Check(GetTile(Candidate).GetValue()))
-					{
-						Tile = Candidate;
-						AlternateFound = true;
-						break;
-					}
+			for (const auto Target : FVulHexSpiral(From, Range))
+			{
+				if (IsVisible(From, Target))
+				{
+					Out.Add(Target);
 				}
+			}
 
-				if (!AlternateFound)
+			return Out;
+		}
+
+		int GetRange() const { return Range; }
+
+	private:
+		friend struct TVulHexgrid;
+
+		int Range = 0;
+
+		/**
+		 * The grid's layout when this was computed.
+		 */
+		FVulHexgridLayout Layout;
+
+		/**
+		 * Maps the offset between two tiles to a bit in a tile's block of Visible.
+		 */
+		FVulHexgridLayout Window;
+
+		/**
+		 * One block of Window.Num() bits per layout index.
+		 */
+		TBitArray<> Visible;
+	};
+
+	/**
+	 * Computes visibility between all tiles within Range of each other, as per Trace, for fast lookup
+	 * when obstacles are static.
+	 *
+	 * Memory use is proportional to the number of tiles multiplied by Range squared.
+	 */
+	FVisibility PrecomputeVisibility(
+		const int Range,
+		const FVulTileValidFn& Check = [](const FVulTile&) { return true; },
+		const float Leeway = 0.01
+	) const {
+		TRACE_CPUPROFILER_EVENT_SCOPE_STR("VulHexgrid::PrecomputeVisibility")
+
+		FVisibility Out;
+		Out.Range = Range;
+		Out.Layout = Layout;
+		Out.Window = FVulHexgridLayout::Hexagonal(Range);
+		Out.Visible.Init(false, Layout.Num() * Out.Window.Num());
+
+		FCachedCheck IsClear(this, Check);
+		const auto Offsets = FVulHexAddr::GenerateGrid(Range);
+
+		for (int32 Index = 0; Index < Tiles.Num(); ++Index)
+		{
+			if (!Valid[Index])
+			{
+				continue;
+			}
+
+			const auto& Origin = Tiles[Index].Addr;
+
+			for (const auto& Offset : Offsets)
+			{
+				const auto Target = Origin.Translate(Offset.Vector());
+
+				if (IsValidAddr(Target) && WalkLine(Origin, Target, Leeway, IsClear, nullptr))
 				{
-					return Result;
+					Out.Visible[Index * Out.Window.Num() + Out.Window.IndexOf(Offset.Q, Offset.R)] = true;
 				}
 			}
-
-			Result.Tiles.Add(Tile);
 		}
 
-		Result.Complete = true;
-		return Result;
+		return Out;
 	}
 
 	/**
@@ -261,344 +440,3313 @@ struct TVulHexgrid
 	};
 
 	/**
-	 * Generates Path query results for all eligible tiles that can be reached within MaxCost.
-	 *
-	 * If MaxCost is omitted, this will generate the shortest path data for all tiles that can
-	 * be reached.
+	 * Result of a @see Reachable query: the cheapest cost to reach every tile reachable from an origin,
+	 * and the tile each was reached from.
 	 *
-	 * This is a heavy call, but is more efficient than making separate Path queries for lots
-	 * of tiles in the grid.
+	 * Stored compactly, as a cost and a predecessor per layout index, rather than as a full path per
+	 * tile. Paths to individual tiles are reconstructed on demand by walking predecessors back to the
+	 * origin.
 	 *
-	 * Note that this only returns completed paths.
+	 * Can be passed back in to Reachable to reuse its memory for subsequent queries. Only valid for
+	 * the grid it was generated from, and only until that grid's layout changes.
 	 */
-	TMap<FVulHexAddr, FPathResult> Paths(
-		const FVulHexAddr& From,
-		const TOptional<CostType> MaxCost = {},
-		const TVulQueryOptions& Opts = TVulQueryOptions()
-	)  const {
-		TMap<FVulHexAddr, FPathResult> Result;
-
-		TArray<TPair<FVulHexAddr, FPathResult>> WorkingSet;
-
-		// Starting point. This is removed from the result set later.
-		WorkingSet.Add({From, FPathResult{
-			.Complete = true,
-			.Tiles = {},
-			.Cost = 0,
-		}});
+	struct FReachable
+	{
+		/**
+		 * The tile the query was made from.
+		 */
+		const FVulHexAddr& GetOrigin() const { return Origin; }
 
-		int I = 0;
-		while (I < WorkingSet.Num())
+		/**
+		 * True if Addr can be reached from the origin. The origin itself is not considered reachable.
+		 */
+		bool IsReachable(const FVulHexAddr& Addr) const
 		{
-			const auto Current = WorkingSet[I];
+			const auto Index = Layout.IndexOf(Addr);
+			return Index != INDEX_NONE && Index != OriginIndex && Predecessors[Index] != INDEX_NONE;
+		}
 
-			for (const auto Next : AdjacentTiles(Current.Key))
+		/**
+		 * The cost of the cheapest path from the origin to Addr, or unset if it cannot be reached.
+		 */
+		TOptional<CostType> GetCost(const FVulHexAddr& Addr) const
+		{
+			if (!IsReachable(Addr))
 			{
-				if (Next.Addr == From)
-				{
-					// Not interested in routes that return to the origin tile.
-					continue;
-				}
-
-				auto Cost = Opts.CostFn(
-					Tiles.FindChecked(Current.Key),
-					Tiles.FindChecked(Next.Addr),
-					this
-				);
+				return {};
+			}
 
-				if (!Cost.IsSet())
-				{
-					continue;
-				}
+			return Costs[Layout.IndexOf(Addr)];
+		}
 
-				if (MaxCost.IsSet() && Cost.GetValue() + Current.Value.Cost > MaxCost.GetValue())
-				{
-					continue;
-				}
+		/**
+		 * The tiles along the cheapest path from the origin to Addr, in walking order. As with
+		 * @see FPathResult, the origin is not included but Addr is.
+		 *
+		 * Empty if Addr cannot be reached.
+		 */
+		TArray<FVulHexAddr> GetPath(const FVulHexAddr& Addr) const
+		{
+			TArray<FVulHexAddr> Out;
 
-				auto NewResult = Current.Value;
-				NewResult.Cost += Cost.GetValue();
-				NewResult.Tiles.Add(Next);
+			if (!IsReachable(Addr))
+			{
+				return Out;
+			}
 
-				if (!Result.Contains(Next.Addr) || NewResult.Cost < Result[Next.Addr].Cost)
-				{
-					Result.Add(Next.Addr, NewResult);
-					WorkingSet.Add({Next.Addr, NewResult});
-				}
+			for (auto Index = Layout.IndexOf(Addr); Index != OriginIndex; Index = Predecessors[Index])
+			{
+				Out.Add(Layout.AddrOf(Index));
 			}
 
-			I++;
+			Algo::Reverse(Out);
+			return Out;
 		}
 
-		Result.Remove(From);
-
-		return Result;
-	}
+		/**
+		 * All reachable tiles, in ascending order of cost.
+		 */
+		TArray<FVulHexAddr> GetReachedAddrs() const
+		{
+			TArray<FVulHexAddr> Out;
+			Out.Reserve(Reached.Num());
 
-	/**
-	 * Finds a path between two tiles, From and To. Opts can be used to customize the path-finding.
-	 *
-	 * Returns one of the best possible paths.
-	 *
-	 * A* Search algorithm adapted from https://www.redblobgames.com/pathfinding/a-star/implementation.html#cpp-astar.
-	 */
-	FPathResult Path(
-		const FVulHexAddr& From,
-		const FVulHexAddr& To,
-		const TVulQueryOptions& Opts = TVulQueryOptions()
-	) const {
-		TRACE_CPUPROFILER_EVENT_SCOPE_STR("VulHexgrid::Path")
+			for (const auto Index : Reached)
+			{
+				Out.Add(Layout.AddrOf(Index));
+			}
 
-		if (From == To)
-		{
-			return {
-				true,
-				{},
-				0
-			};
+			return Out;
 		}
 
-		struct FSearchNode
+		/**
+		 * All reachable tiles as a region laid out like the grid.
+		 */
+		FVulHexRegion GetReachedRegion() const
 		{
-			CostType Cost;
-			FVulHexAddr Address;
+			FVulHexRegion Out(Layout);
 
-			/**
-			 * Used to select which node in the resulting data structure is closest.
-			 */
-			CostType RemainingEstimatedCost;
-		};
+			for (const auto Index : Reached)
+			{
+				Out.AddIndex(Index);
+			}
 
-		// All of the tiles that we've visited and the real cost to get that far.
-		TMap<FVulHexAddr, FSearchNode> Visited = {{From, {0, From, Opts.Heuristic(From, To)}}};
-		// The tiles on the edge of our search space thus far. With its estimated cost (euclidean distance to goal).
-		// The node in this list with the lowest score is the next one we'll check.
-		auto Frontier = TVulPriorityQueue<FVulHexAddr, CostType>();
-		Frontier.Add(From, 0);
+			return Out;
+		}
 
-		while (!Frontier.IsEmpty())
+		/**
+		 * The number of reachable tiles.
+		 */
+		int32 Num() const { return Reached.Num(); }
+
+	private:
+		friend struct TVulHexgrid;
+
+		/**
+		 * Frontier priority. Ties are broken by the order tiles were queued, so that equal-cost
+		 * routes resolve the same way as a breadth-first search would.
+		 */
+		struct FPriority
 		{
-			auto Current = Frontier.Get().GetValue();
+			CostType Cost;
+			int32 Sequence;
 
-			if (Current.Element == To)
+			bool operator<(const FPriority& Other) const
 			{
-				break;
+				return Cost < Other.Cost || (Cost == Other.Cost && Sequence < Other.Sequence);
 			}
+		};
 
-			for (auto Next : AdjacentTiles(Current.Element))
+		/**
+		 * Records a route to Index via Parent if it's cheaper than any found so far, queueing Index to
+		 * be expanded. A tile that has already been expanded is queued again.
+		 */
+		FORCEINLINE void Relax(const int32 Index, const int32 Parent, const CostType Cost)
+		{
+			if (Predecessors[Index] == INDEX_NONE)
 			{
-				auto Cost = Opts.CostFn(
-					Tiles.FindChecked(Current.Element),
-					Tiles.FindChecked(Next.Addr),
-					this
-				);
-
-				if (!Cost.IsSet())
+				FrontierHandles[Index] = Frontier.Add(Index, {Cost, Sequence++});
+			} else if (Cost < Costs[Index])
+			{
+				if (Frontier.IsQueued(FrontierHandles[Index]))
+				{
+					Frontier.Update(FrontierHandles[Index], {Cost, Sequence++});
+				} else
 				{
-					continue;
+					FrontierHandles[Index] = Frontier.Add(Index, {Cost, Sequence++});
 				}
+			} else
+			{
+				return;
+			}
+
+			Predecessors[Index] = Parent;
+			Costs[Index] = Cost;
+		}
 
-				const CostType NewCost = Visited.FindChecked(Current.Element).Cost + Cost.GetValue();
+		/**
+		 * Rebuilds Reached from Predecessors, in ascending order of cost.
+		 */
+		void RebuildReached()
+		{
+			Reached.Reset();
 
-				if (!Visited.Contains(Next.Addr) || NewCost < Visited.FindChecked(Next.Addr).Cost)
+			for (int32 Index = 0; Index < Predecessors.Num(); ++Index)
+			{
+				if (Predecessors[Index] != INDEX_NONE && Index != OriginIndex)
 				{
-					const auto EstimatedCost = Opts.Heuristic(Next.Addr, To);
-					Visited.Add(Next.Addr, FSearchNode{NewCost, Current.Element, EstimatedCost});
-					Frontier.Add(Next.Addr, NewCost + EstimatedCost);
+					Reached.Add(Index);
 				}
 			}
-		}
 
-		FPathResult Result;
-
-		if (Visited.IsEmpty())
-		{
-			// Exhausted all paths.
-			return Result;
+			Reached.StableSort([this](const int32 A, const int32 B) { return Costs[A] < Costs[B]; });
 		}
 
-		// Grab a path with the lowest remaining estimated cost according to our heuristic.
-		// For complete paths, this will generally be 0 (depending on the heuristic).
-		TOptional<TPair<FVulHexAddr, FSearchNode>> Closest;
-
-		for (auto Entry : Visited)
+		/**
+		 * Forgets all reached tiles that cost more than MaxCost to reach.
+		 */
+		void Truncate(const CostType MaxCost)
 		{
-			if (!Closest.IsSet() || Closest.GetValue().Value.RemainingEstimatedCost > Entry.Value.RemainingEstimatedCost)
+			auto Keep = Reached.Num();
+
+			while (Keep > 0 && Costs[Reached[Keep - 1]] > MaxCost)
 			{
-				Closest = Entry;
+				Predecessors[Reached[--Keep]] = INDEX_NONE;
 			}
-		}
 
-		// Walk the path in reverse back to the start point, building a path result along the way.
-		auto Current = Closest.GetValue().Key;
+			Reached.SetNum(Keep);
+		}
 
-		do
+		/**
+		 * Prepares for a new query, clearing only what the previous query wrote if the layout is unchanged.
+		 */
+		void Begin(const FVulHexgridLayout& InLayout, const int32 InOriginIndex)
 		{
-			Result.Tiles.Add(Tiles.FindChecked(Current));
-			Current = Visited[Current].Address;
-		} while (Current != Visited[Current].Address);
+			if (Layout != InLayout || Predecessors.Num() != InLayout.Num())
+			{
+				Layout = InLayout;
+				Costs.SetNumUninitialized(Layout.Num());
+				Predecessors.Init(INDEX_NONE, Layout.Num());
+				FrontierHandles.SetNumUninitialized(Layout.Num());
+			} else
+			{
+				for (const auto Index : Reached)
+				{
+					Predecessors[Index] = INDEX_NONE;
+				}
 
-		Result.Complete = Result.Tiles[0].Addr == To;
-		Result.Cost = Visited[Closest->Key].Cost;
+				if (OriginIndex != INDEX_NONE)
+				{
+					Predecessors[OriginIndex] = INDEX_NONE;
+				}
+			}
+
+			OriginIndex = InOriginIndex;
+			Origin = Layout.AddrOf(OriginIndex);
+			Reached.Reset();
+			Frontier.Reset();
+			Sequence = 0;
+		}
+
+		FVulHexAddr Origin;
+		int32 OriginIndex = INDEX_NONE;
+		FVulHexgridLayout Layout;
+
+		/**
+		 * Per layout index. Only meaningful where Predecessors is set.
+		 */
+		TArray<CostType> Costs;
+
+		/**
+		 * Per layout index, the index of the tile it was reached from, or INDEX_NONE if not reached.
+		 * The origin is its own predecessor.
+		 */
+		TArray<int32> Predecessors;
+
+		/**
+		 * Layout indices of reachable tiles, in the order they were settled.
+		 */
+		TArray<int32> Reached;
+
+		// Working memory for the search itself.
+		TVulIndexedPriorityQueue<int32, FPriority> Frontier;
+		TArray<int32> FrontierHandles;
+		int32 Sequence = 0;
+	};
+
+	/**
+	 * Finds the cheapest cost to reach every tile that can be reached from From within MaxCost.
+	 *
+	 * If MaxCost is omitted, all tiles that can be reached are included.
+	 *
+	 * This runs a single Dijkstra search, so is much cheaper than making separate Path queries for
+	 * lots of tiles in the grid. Only Opts.CostFn is used.
+	 */
+	FReachable Reachable(
+		const FVulHexAddr& From,
+		const TOptional<CostType> MaxCost = {},
+		const TVulQueryOptions& Opts = TVulQueryOptions()
+	) const {
+		FReachable Out;
+		Reachable(From, MaxCost, Opts, Out);
+		return Out;
+	}
+
+	/**
+	 * As above, but writes to an existing result, reusing its memory.
+	 */
+	void Reachable(
+		const FVulHexAddr& From,
+		const TOptional<CostType> MaxCost,
+		const TVulQueryOptions& Opts,
+		FReachable& Out
+	) const {
+		TRACE_CPUPROFILER_EVENT_SCOPE_STR("VulHexgrid::Reachable")
+
+		const auto FromIndex = TileIndex(From);
+
+		if (FromIndex == INDEX_NONE)
+		{
+			Out = FReachable();
+			return;
+		}
+
+		if (const auto Cached = CachedReachable(From, Opts))
+		{
+			Out = *Cached;
+
+			if (MaxCost.IsSet())
+			{
+				Out.Truncate(MaxCost.GetValue());
+			}
+
+			return;
+		}
+
+		Flood(FromIndex, MaxCost, Opts.CostFn, Out);
+	}
+
+	/**
+	 * As Reachable, but CostFn may be any callable with the signature of TVulQueryOptions::CostFn, which
+	 * the compiler can inline in to the search, @see PathWith. The path cache is not used.
+	 */
+	template <typename CostFnType>
+	void ReachableWith(
+		const FVulHexAddr& From,
+		const TOptional<CostType> MaxCost,
+		const CostFnType& CostFn,
+		FReachable& Out
+	) const {
+		TRACE_CPUPROFILER_EVENT_SCOPE_STR("VulHexgrid::ReachableWith")
+
+		const auto FromIndex = TileIndex(From);
+
+		if (FromIndex == INDEX_NONE)
+		{
+			Out = FReachable();
+			return;
+		}
+
+		Flood(FromIndex, MaxCost, CostFn, Out);
+	}
+
+	/**
+	 * Enables caching of @see Reachable results for up to Capacity origins, or disables the cache if 0.
+	 *
+	 * Once enabled, queries made with a TVulQueryOptions::CacheKey are answered from the cache where
+	 * possible. This covers Reachable, Paths and Path (where the destination can be reached). Cached
+	 * results cover the entire reachable grid regardless of any max cost, so the first query from an
+	 * origin may be more expensive than an uncached one.
+	 *
+	 * Editing tiles does not clear the cache. Instead, the next query from a cached origin repairs its
+	 * result, re-searching only the tiles whose routes went through edited tiles. For this to be
+	 * correct, cost functions used with the cache must only depend on the two tiles they're given.
+	 * Adding a tile outside the grid's current layout clears the cache.
+	 *
+	 * When enabled, queries modify the cache, so even const queries are not threadsafe.
+	 */
+	void SetPathCacheCapacity(const int32 Capacity)
+	{
+		checkf(Capacity >= 0, TEXT("Path cache capacity must not be negative"))
+
+		PathCache.Capacity = Capacity;
+
+		while (PathCache.Entries.Num() > Capacity)
+		{
+			PathCache.EvictLeastRecentlyUsed();
+		}
+
+		PathCache.Entries.Reserve(Capacity);
+	}
+
+	int32 GetPathCacheCapacity() const
+	{
+		return PathCache.Capacity;
+	}
+
+	/**
+	 * Discards all cached path results, @see SetPathCacheCapacity.
+	 */
+	void ClearPathCache()
+	{
+		PathCache.Entries.Reset();
+		PathCache.Edits.Reset();
+	}
+
+	/**
+	 * Returns the cached Reachable result from From, computing or repairing it first if needed.
+	 *
+	 * Returns nullptr if the cache is disabled, Opts has no CacheKey, or From is not a tile in this grid.
+	 * The returned result is valid until the next query or change to this grid.
+	 */
+	const FReachable* CachedReachable(const FVulHexAddr& From, const TVulQueryOptions& Opts) const
+	{
+		const auto FromIndex = TileIndex(From);
+
+		if (PathCache.Capacity == 0 || Opts.CacheKey.IsNone() || FromIndex == INDEX_NONE)
+		{
+			return nullptr;
+		}
+
+		TRACE_CPUPROFILER_EVENT_SCOPE_STR("VulHexgrid::CachedReachable")
+
+		auto Entry = PathCache.Entries.FindByPredicate([&](const FPathCacheEntry& Candidate)
+		{
+			return Candidate.Result.OriginIndex == FromIndex && Candidate.CacheKey == Opts.CacheKey;
+		});
+
+		if (Entry == nullptr)
+		{
+			if (PathCache.Entries.Num() >= PathCache.Capacity)
+			{
+				PathCache.EvictLeastRecentlyUsed();
+			}
+
+			Entry = &PathCache.Entries.AddDefaulted_GetRef();
+			Entry->CacheKey = Opts.CacheKey;
+			Flood(FromIndex, {}, Opts.CostFn, Entry->Result);
+		} else if (Entry->EditsSeen < PathCache.Edits.Num())
+		{
+			RepairReachable(
+				Entry->Result,
+				TConstArrayView<int32>(PathCache.Edits).Slice(Entry->EditsSeen, PathCache.Edits.Num() - Entry->EditsSeen),
+				Opts
+			);
+		}
+
+		Entry->EditsSeen = PathCache.Edits.Num();
+		Entry->LastUsed = ++PathCache.UseCounter;
+		PathCache.TrimEdits();
+
+		return &Entry->Result;
+	}
+
+	/**
+	 * Enables hierarchical path finding (HPA*) for long @see Path queries made with CacheKey if
+	 * ChunkSize > 0, or disables it if 0.
+	 *
+	 * The grid is divided into ChunkSize x ChunkSize chunks of its layout. Where tiles in neighbouring
+	 * chunks can be moved between, a tile either side of each stretch of shared border becomes an
+	 * entrance. The cheapest routes between the entrances of each chunk are precomputed, so a long query
+	 * searches this much smaller graph of entrances before refining each step of it within a chunk.
+	 *
+	 * Once enabled, Path queries made with a TVulQueryOptions::CacheKey equal to CacheKey between tiles
+	 * more than two chunks apart use the hierarchy. Queries with other keys search as usual. Such paths are complete whenever the hierarchy finds a route, but
+	 * are not guaranteed to be the cheapest, as routes must pass through entrances. If the hierarchy
+	 * finds no route, Path falls back to a regular search so incomplete results are unchanged. Path
+	 * results answered from the path cache take precedence, @see SetPathCacheCapacity.
+	 *
+	 * The hierarchy is built when first queried. Editing tiles marks the affected chunks to be rebuilt
+	 * on the next query. Adding a tile outside the grid's current layout rebuilds the hierarchy entirely.
+	 * As with the path cache, cost functions must only depend on the two tiles they're given.
+	 *
+	 * When enabled, queries may modify the hierarchy, so even const queries are not threadsafe.
+	 */
+	void SetPathHierarchy(const int32 ChunkSize, const FName CacheKey)
+	{
+		checkf(ChunkSize >= 0, TEXT("Path hierarchy chunk size must not be negative"))
+		checkf(ChunkSize == 0 || !CacheKey.IsNone(), TEXT("Path hierarchy must be given a cache key"))
+
+		PathHierarchy.ChunkSize = ChunkSize;
+		PathHierarchy.CacheKey = CacheKey;
+		ClearPathHierarchy();
+	}
+
+	int32 GetPathHierarchyChunkSize() const
+	{
+		return PathHierarchy.ChunkSize;
+	}
+
+	/**
+	 * Discards the path hierarchy, which is rebuilt by the next query that uses it,
+	 * @see SetPathHierarchy.
+	 */
+	void ClearPathHierarchy()
+	{
+		PathHierarchy.Chunks.Reset();
+		PathHierarchy.Dirty.Reset();
+		PathHierarchy.bAnyDirty = false;
+	}
+
+	/**
+	 * Enables a connected-components index over the tiles for which Passable returns true, so whether
+	 * two tiles can reach each other at all is known without searching.
+	 *
+	 * Once enabled, Path queries made with a TVulQueryOptions::CacheKey equal to CacheKey return an
+	 * incomplete, empty result straight away when To is not reachable from From, rather than searching
+	 * the whole of From's side of the grid for the closest approach. For this to be correct, cost
+	 * functions used with CacheKey must not allow moving in to a tile that is not Passable.
+	 *
+	 * The index is built when first queried. Editing tiles updates it on the next query: tiles becoming
+	 * passable merge their neighbours' components, and tiles becoming impassable relabel only the
+	 * component they were in. Adding a tile outside the grid's current layout rebuilds it entirely.
+	 *
+	 * When enabled, queries may modify the index, so even const queries are not threadsafe.
+	 */
+	void SetConnectivity(const FVulTileValidFn& Passable, const FName CacheKey = NAME_None)
+	{
+		Connectivity.Passable = Passable;
+		Connectivity.CacheKey = CacheKey;
+		Connectivity.bEnabled = true;
+		ClearConnectivity();
+	}
+
+	/**
+	 * Disables the connected-components index, @see SetConnectivity.
+	 */
+	void DisableConnectivity()
+	{
+		Connectivity = FConnectivity();
+	}
+
+	/**
+	 * Discards the connected-components index, which is rebuilt by the next query that uses it,
+	 * @see SetConnectivity.
+	 */
+	void ClearConnectivity()
+	{
+		Connectivity.Labels.Reset();
+		Connectivity.Parents.Reset();
+		Connectivity.Edits.Reset();
+	}
+
+	/**
+	 * The connected component that the tile at Addr belongs to, or INDEX_NONE if it is not a passable
+	 * tile or connectivity is disabled, @see SetConnectivity.
+	 *
+	 * Tiles share a component if and only if they are connected by passable tiles. Component ids are
+	 * only comparable until the grid next changes.
+	 */
+	int32 ComponentOf(const FVulHexAddr& Addr) const
+	{
+		const auto Index = TileIndex(Addr);
+
+		if (!Connectivity.bEnabled || Index == INDEX_NONE)
+		{
+			return INDEX_NONE;
+		}
+
+		UpdateConnectivity();
+		return Connectivity.ComponentOf(Index);
+	}
+
+	/**
+	 * True if A and B are both passable tiles in the same connected component, @see SetConnectivity.
+	 */
+	bool IsConnected(const FVulHexAddr& A, const FVulHexAddr& B) const
+	{
+		const auto Component = ComponentOf(A);
+		return Component != INDEX_NONE && Component == ComponentOf(B);
+	}
+
+	/**
+	 * Reconstructs the path to To from a previous @see Reachable query on this grid.
+	 *
+	 * The result is incomplete and empty if To could not be reached.
+	 */
+	FPathResult ReachablePath(const FReachable& Reached, const FVulHexAddr& To) const
+	{
+		FPathResult Result{false, {}, 0};
+
+		if (!Reached.IsReachable(To))
+		{
+			return Result;
+		}
+
+		for (const auto& Addr : Reached.GetPath(To))
+		{
+			Result.Tiles.Add(TileAt(Addr));
+		}
+
+		Result.Complete = true;
+		Result.Cost = Reached.GetCost(To).GetValue();
+
+		return Result;
+	}
+
+	/**
+	 * Generates Path query results for all eligible tiles that can be reached within MaxCost.
+	 *
+	 * If MaxCost is omitted, this will generate the shortest path data for all tiles that can
+	 * be reached.
+	 *
+	 * Every result holds a copy of its full path, so prefer @see Reachable, which returns a compact
+	 * representation of the same information.
+	 *
+	 * Note that this only returns completed paths.
+	 */
+	TMap<FVulHexAddr, FPathResult> Paths(
+		const FVulHexAddr& From,
+		const TOptional<CostType> MaxCost = {},
+		const TVulQueryOptions& Opts = TVulQueryOptions()
+	)  const {
+		const auto Reached = Reachable(From, MaxCost, Opts);
+
+		TMap<FVulHexAddr, FPathResult> Result;
+		Result.Reserve(Reached.Num());
+
+		for (const auto& Addr : Reached.GetReachedAddrs())
+		{
+			Result.Add(Addr, ReachablePath(Reached, Addr));
+		}
+
+		return Result;
+	}
+
+	/**
+	 * The cost written to distance fields for tiles that cannot be reached, and for layout indices
+	 * that are not tiles in this grid. @see DistanceField.
+	 */
+	static constexpr CostType UnreachedCost = TNumericLimits<CostType>::Max();
+
+	/**
+	 * Computes the cost from the nearest of Sources to every tile in one search, e.g. for
+	 * "distance to the nearest enemy" for each tile.
+	 *
+	 * OutCosts is indexed by layout index, @see GetLayout, and holds UnreachedCost for tiles that
+	 * cannot be reached from any source within MaxCost. If provided, OutNearestSource receives the
+	 * index in Sources of the nearest source per tile, or INDEX_NONE if unreached.
+	 *
+	 * Sources that are not tiles in this grid are ignored. Only Opts.CostFn is used.
+	 */
+	void DistanceField(
+		const TConstArrayView<FVulHexAddr> Sources,
+		TArray<CostType>& OutCosts,
+		const TOptional<CostType> MaxCost = {},
+		const TVulQueryOptions& Opts = TVulQueryOptions(),
+		TArray<int32>* OutNearestSource = nullptr
+	) const {
+		TRACE_CPUPROFILER_EVENT_SCOPE_STR("VulHexgrid::DistanceField")
+
+		TArray<TPair<int32, CostType>> Seeds;
+		Seeds.Reserve(Sources.Num());
+
+		for (const auto& Source : Sources)
+		{
+			Seeds.Add({TileIndex(Source), 0});
+		}
+
+		MultiSourceFlood(Seeds, MaxCost, Opts, OutCosts, OutNearestSource);
+	}
+
+	/**
+	 * A source of influence for @see InfluenceMap.
+	 */
+	struct FInfluenceSource
+	{
+		FVulHexAddr Addr;
+
+		/**
+		 * The influence at Addr itself. Influence falls off by the cost of moving away from Addr.
+		 */
+		CostType Strength;
+	};
+
+	/**
+	 * How @see InfluenceMap combines sources that influence the same tile.
+	 */
+	enum class EInfluenceBlend : uint8
+	{
+		/**
+		 * A tile takes the influence of its strongest source only, found in one search across all sources.
+		 */
+		Strongest,
+
+		/**
+		 * A tile takes the sum of every source's influence, so two adjacent sources count double. Each
+		 * source is searched separately, but only as far as its influence reaches.
+		 */
+		Sum,
+	};
+
+	/**
+	 * Spreads influence from Sources across the grid, e.g. for the threat posed by all enemies to
+	 * each tile (Sum), or by the most threatening enemy (Strongest).
+	 *
+	 * A source's influence on a tile is its Strength less the cost to reach that tile from it, as
+	 * per Opts.CostFn. Blend decides how overlapping sources combine. OutInfluence is indexed by
+	 * layout index, @see GetLayout, and holds 0 where no source has any influence.
+	 *
+	 * Sources that are not tiles in this grid or that have no strength are ignored.
+	 */
+	void InfluenceMap(
+		const TConstArrayView<FInfluenceSource> Sources,
+		TArray<CostType>& OutInfluence,
+		const TVulQueryOptions& Opts = TVulQueryOptions(),
+		const EInfluenceBlend Blend = EInfluenceBlend::Strongest
+	) const {
+		TRACE_CPUPROFILER_EVENT_SCOPE_STR("VulHexgrid::InfluenceMap")
+
+		if (Blend == EInfluenceBlend::Sum)
+		{
+			SumInfluence(Sources, OutInfluence, Opts);
+			return;
+		}
+
+		CostType MaxStrength = 0;
+
+		for (const auto& Source : Sources)
+		{
+			MaxStrength = FMath::Max(MaxStrength, Source.Strength);
+		}
+
+		// Strongest influence is equivalent to the nearest source if weaker sources start
+		// further away, so this is a distance field with offset start costs.
+		TArray<TPair<int32, CostType>> Seeds;
+		Seeds.Reserve(Sources.Num());
+
+		for (const auto& Source : Sources)
+		{
+			Seeds.Add({Source.Strength > 0 ? TileIndex(Source.Addr) : INDEX_NONE, MaxStrength - Source.Strength});
+		}
+
+		MultiSourceFlood(Seeds, MaxStrength, Opts, OutInfluence, nullptr);
+
+		for (auto& Influence : OutInfluence)
+		{
+			Influence = Influence == UnreachedCost ? 0 : MaxStrength - Influence;
+		}
+	}
+
+	/**
+	 * Reusable working memory for @see Path queries.
+	 *
+	 * A scratch that has already been used for a query on a grid with the same layout makes
+	 * subsequent queries allocation-free (bar the returned result). Keep one around, one per
+	 * thread, when making many path queries.
+	 *
+	 * Per-tile search state is stamped with a generation that is bumped at the start of each
+	 * query, so nothing needs clearing between queries.
+	 */
+	struct FSearchScratch
+	{
+	private:
+		friend struct TVulHexgrid;
+
+		struct FSearchNode
+		{
+			/**
+			 * Equal to the scratch's Generation if this node has been visited in the current query.
+			 */
+			uint32 Generation = 0;
+
+			/**
+			 * The layout index of the tile we reached this tile from.
+			 */
+			int32 Parent = INDEX_NONE;
+
+			CostType Cost;
+
+			/**
+			 * Used to select which node in the resulting data structure is closest.
+			 */
+			CostType RemainingEstimatedCost;
+
+			/**
+			 * This node's entry in the frontier, so a cheaper route to it updates its priority
+			 * rather than queueing it again. Only meaningful if visited in the current query.
+			 */
+			int32 FrontierHandle = INDEX_NONE;
+		};
+
+		TArray<FSearchNode> Nodes;
+
+		/**
+		 * Tiles on the edge of the search, keyed by layout index.
+		 */
+		TVulIndexedPriorityQueue<int32, CostType> Frontier;
+
+		/**
+		 * Layout indices in the order they were first visited, so ties for the closest
+		 * tile are resolved deterministically.
+		 */
+		TArray<int32> VisitOrder;
+
+		/**
+		 * Frontier of uniform-cost searches, keyed by layout index. Of equal priority, the most
+		 * recently queued tile comes out first, @see UniformSearch.
+		 */
+		TVulBucketPriorityQueue<int32, int32, true> UniformFrontier;
+
+		uint32 Generation = 0;
+
+		void Begin(const int32 NumSlots)
+		{
+			if (Nodes.Num() != NumSlots)
+			{
+				Nodes.Reset();
+				Nodes.SetNum(NumSlots);
+				Generation = 0;
+			}
+
+			if (++Generation == 0)
+			{
+				// Wrapped around; old stamps could now collide with the current generation.
+				for (auto& Node : Nodes)
+				{
+					Node.Generation = 0;
+				}
+
+				Generation = 1;
+			}
+
+			Frontier.Reset();
+			VisitOrder.Reset();
+		}
+
+		FORCEINLINE bool IsVisited(const int32 Index) const
+		{
+			return Nodes[Index].Generation == Generation;
+		}
+
+		FORCEINLINE void Visit(const int32 Index, const int32 Parent, const CostType Cost, const CostType Remaining)
+		{
+			auto& Node = Nodes[Index];
+
+			if (Node.Generation != Generation)
+			{
+				Node.Generation = Generation;
+				Node.FrontierHandle = INDEX_NONE;
+				VisitOrder.Add(Index);
+			}
+
+			Node.Parent = Parent;
+			Node.Cost = Cost;
+			Node.RemainingEstimatedCost = Remaining;
+		}
+
+		/**
+		 * Queues a visited node for expansion with the given priority, or lowers its priority
+		 * if it is already queued.
+		 */
+		FORCEINLINE void Enqueue(const int32 Index, const CostType Priority)
+		{
+			auto& Node = Nodes[Index];
+
+			if (Frontier.IsQueued(Node.FrontierHandle))
+			{
+				Frontier.Update(Node.FrontierHandle, Priority);
+			} else
+			{
+				Node.FrontierHandle = Frontier.Add(Index, Priority);
+			}
+		}
+	};
+
+	/**
+	 * Finds a path between two tiles, From and To. Opts can be used to customize the path-finding.
+	 *
+	 * Returns one of the best possible paths, unless answered by the path hierarchy, which may return a
+	 * slightly costlier path, @see SetPathHierarchy. Options made by TVulQueryOptions::Uniform
+	 * use a faster search specialised for uniform costs.
+	 *
+	 * A* Search algorithm adapted from https://www.redblobgames.com/pathfinding/a-star/implementation.html#cpp-astar.
+	 */
+	FPathResult Path(
+		const FVulHexAddr& From,
+		const FVulHexAddr& To,
+		const TVulQueryOptions& Opts = TVulQueryOptions()
+	) const {
+		FSearchScratch Scratch;
+		return Path(From, To, Opts, Scratch);
+	}
+
+	/**
+	 * As above, but uses the provided Scratch for the search's working memory.
+	 *
+	 * Reusing a scratch across queries avoids allocating search state for every query.
+	 */
+	FPathResult Path(
+		const FVulHexAddr& From,
+		const FVulHexAddr& To,
+		const TVulQueryOptions& Opts,
+		FSearchScratch& Scratch
+	) const {
+		TRACE_CPUPROFILER_EVENT_SCOPE_STR("VulHexgrid::Path")
+
+		if (From == To)
+		{
+			return {
+				true,
+				{},
+				0
+			};
+		}
+
+		const auto FromIndex = TileIndex(From);
+
+		if (FromIndex == INDEX_NONE)
+		{
+			return {false, {}, 0};
+		}
+
+		// Unset if To is not in the grid, in which case we'll get as close as we can.
+		const auto ToIndex = TileIndex(To);
+
+		if (ToIndex != INDEX_NONE && IsKnownUnreachable(FromIndex, ToIndex, Opts))
+		{
+			return {false, {}, 0};
+		}
+
+		if (const auto Cached = CachedReachable(From, Opts); Cached != nullptr && Cached->IsReachable(To))
+		{
+			return ReachablePath(*Cached, To);
+		}
+
+		if (ToIndex != INDEX_NONE && UsesPathHierarchy(From, To, Opts))
+		{
+			if (auto Hierarchical = HierarchicalPath(FromIndex, ToIndex, Opts, Scratch); Hierarchical.IsSet())
+			{
+				return MoveTemp(Hierarchical.GetValue());
+			}
+		}
+
+		return SearchPath(FromIndex, ToIndex, To, Opts, Scratch);
+	}
+
+	/**
+	 * A single query for @see PathBatch.
+	 */
+	struct FPathRequest
+	{
+		FVulHexAddr From;
+		FVulHexAddr To;
+		TVulQueryOptions Opts;
+	};
+
+	/**
+	 * Runs many @see Path queries at once, spread across task graph worker threads, e.g. for every
+	 * agent at the start of a turn. Results are in the order of Requests.
+	 *
+	 * Each query is a regular search: the path cache, path hierarchy and connectivity index are not
+	 * used, as queries update them. Results are therefore identical to making the same queries one by
+	 * one with those disabled, however the work is split between threads.
+	 *
+	 * The grid must not be modified until this returns, and each request's CostFn, Heuristic and
+	 * Passable are called from several threads at once, so must be threadsafe.
+	 */
+	TArray<FPathResult> PathBatch(const TConstArrayView<FPathRequest> Requests) const
+	{
+		TArray<FPathResult> Out;
+		TArray<FSearchScratch> Scratches;
+		PathBatch(Requests, Out, Scratches);
+		return Out;
+	}
+
+	/**
+	 * As above, but writes to Out and reuses Scratches, one per thread, for the searches' working memory.
+	 *
+	 * Keep Scratches around between batches so that subsequent batches are allocation-free bar results.
+	 */
+	void PathBatch(
+		const TConstArrayView<FPathRequest> Requests,
+		TArray<FPathResult>& Out,
+		TArray<FSearchScratch>& Scratches
+	) const {
+		TRACE_CPUPROFILER_EVENT_SCOPE_STR("VulHexgrid::PathBatch")
+
+		Out.SetNum(Requests.Num());
+
+		// Requests are striped across threads, as neighbouring requests are often similarly expensive.
+		const auto NumThreads = FMath::Min(Requests.Num(), FTaskGraphInterface::Get().GetNumWorkerThreads() + 1);
+
+		if (Scratches.Num() < NumThreads)
+		{
+			Scratches.SetNum(NumThreads);
+		}
+
+		ParallelFor(NumThreads, [&](const int32 Thread)
+		{
+			for (int32 I = Thread; I < Requests.Num(); I += NumThreads)
+			{
+				const auto& Request = Requests[I];
+				const auto FromIndex = TileIndex(Request.From);
+
+				if (Request.From == Request.To)
+				{
+					Out[I] = {true, {}, 0};
+				} else if (FromIndex == INDEX_NONE)
+				{
+					Out[I] = {false, {}, 0};
+				} else
+				{
+					Out[I] = SearchPath(FromIndex, TileIndex(Request.To), Request.To, Request.Opts, Scratches[Thread]);
+				}
+			}
+		});
+	}
+
+	/**
+	 * As Path, but CostFn and Heuristic may be any callables with the signatures of
+	 * TVulQueryOptions::CostFn and TVulQueryOptions::Heuristic, e.g. lambdas or functors.
+	 *
+	 * These are called directly rather than through a TFunction, so the compiler can inline them in to
+	 * the search. Prefer this for frequent queries with a fixed cost function. This is always a plain A*
+	 * search; the path cache, path hierarchy and connectivity index are not used.
+	 */
+	template <typename CostFnType, typename HeuristicFnType>
+	FPathResult PathWith(
+		const FVulHexAddr& From,
+		const FVulHexAddr& To,
+		const CostFnType& CostFn,
+		const HeuristicFnType& Heuristic,
+		FSearchScratch& Scratch
+	) const {
+		TRACE_CPUPROFILER_EVENT_SCOPE_STR("VulHexgrid::PathWith")
+
+		if (From == To)
+		{
+			return {true, {}, 0};
+		}
+
+		const auto FromIndex = TileIndex(From);
+
+		if (FromIndex == INDEX_NONE)
+		{
+			return {false, {}, 0};
+		}
+
+		const auto ToIndex = TileIndex(To);
+
+		Scratch.Begin(Tiles.Num());
+		AStar(FromIndex, ToIndex, To, CostFn, Heuristic, Scratch);
+		return SearchResult(Scratch, ToIndex);
+	}
+
+	/**
+	 * As above, using TVulQueryOptions::DefaultHeuristic.
+	 */
+	template <typename CostFnType>
+	FPathResult PathWith(
+		const FVulHexAddr& From,
+		const FVulHexAddr& To,
+		const CostFnType& CostFn,
+		FSearchScratch& Scratch
+	) const {
+		return PathWith(From, To, CostFn, &TVulQueryOptions::DefaultHeuristic, Scratch);
+	}
+
+	/**
+	 * Returns the size of this grid, that is the number of tiles from the center to an edge.
+	 */
+	int TileCount() const { return ValidCount; };
+
+	/**
+	 * All tiles in the grid, in layout order.
+	 */
+	TArray<FVulTile> GetTiles() const
+	{
+		TArray<FVulTile> Out;
+		Out.Reserve(ValidCount);
+
+		for (int32 Index = 0; Index < Tiles.Num(); ++Index)
+		{
+			if (Valid[Index])
+			{
+				Out.Add(Tiles[Index]);
+			}
+		}
+
+		return Out;
+	}
+
+	/**
+	 * Gets all the addresses that make up this grid.
+	 */
+	TArray<FVulHexAddr> GetTileAddrs() const
+	{
+		TArray<FVulHexAddr> Out;
+		Out.Reserve(ValidCount);
+
+		for (int32 Index = 0; Index < Tiles.Num(); ++Index)
+		{
+			if (Valid[Index])
+			{
+				Out.Add(Tiles[Index].Addr);
+			}
+		}
+
+		return Out;
+	}
+
+	TOptional<FVulTile> GetTile(const FVulHexAddr& Addr) const
+	{
+		const auto Index = TileIndex(Addr);
+
+		if (Index == INDEX_NONE)
+		{
+			return {};
+		}
+
+		return Tiles[Index];
+	}
+
+	TOptional<FVulTile> Find(const FVulHexAddr& Addr) const
+	{
+		return GetTile(Addr);
+	}
+
+	/**
+	 * Returns the tile at Addr without copying it. Addr must be a valid tile in this grid.
+	 */
+	const FVulTile& TileAt(const FVulHexAddr& Addr) const
+	{
+		const auto Index = TileIndex(Addr);
+		checkf(Index != INDEX_NONE, TEXT("Addr=%s is not valid for this grid"), *Addr.ToString())
+		return Tiles[Index];
+	}
+
+	/**
+	 * Returns the tile at a layout index. Index must be a valid tile index, @see IsValidIndex.
+	 */
+	const FVulTile& TileAtIndex(const int32 Index) const
+	{
+		checkf(IsValidIndex(Index), TEXT("Index=%d is not a valid tile for this grid"), Index)
+		return Tiles[Index];
+	}
+
+	/**
+	 * Returns the layout index of Addr, or INDEX_NONE if Addr is not a tile in this grid.
+	 *
+	 * Indices are stable until the grid is re-laid out by adding a tile outside its current layout.
+	 */
+	FORCEINLINE int32 TileIndex(const FVulHexAddr& Addr) const
+	{
+		const auto Index = Layout.IndexOf(Addr);
+		return Index != INDEX_NONE && Valid[Index] ? Index : INDEX_NONE;
+	}
+
+	/**
+	 * True if the layout index refers to a tile in this grid.
+	 */
+	FORCEINLINE bool IsValidIndex(const int32 Index) const
+	{
+		return Index >= 0 && Index < Tiles.Num() && Valid[Index];
+	}
+
+	/**
+	 * The layout that maps addresses to tile storage. Useful for building per-tile buffers
+	 * that are indexed in the same way as this grid.
+	 */
+	const FVulHexgridLayout& GetLayout() const
+	{
+		return Layout;
+	}
+
+	void SetTileData(const FVulHexAddr& Addr, const TileData& Data)
+	{
+		if (!ensureMsgf(IsValidAddr(Addr), TEXT("Cannot add to grid. Addr=%s is not valid for this grid"), *Addr.ToString()))
+		{
+			return;
+		}
+
+		Tiles[Layout.IndexOf(Addr)] = FVulTile(Addr, Data);
+		RecordEdit(Layout.IndexOf(Addr));
+	}
+
+	/**
+	 * Returns a pointer to modify the tile at Addr in place.
+	 *
+	 * The pointer is valid until the grid's layout changes, @see AddTile.
+	 *
+	 * The tile is assumed to be modified, so cached paths through it are repaired on their next query.
+	 */
+	FVulTile* ModifyTileData(const FVulHexAddr& Addr)
+	{
+		if (!ensureMsgf(IsValidAddr(Addr), TEXT("Cannot modify grid data. Addr=%s is not valid for this grid"), *Addr.ToString()))
+		{
+			return nullptr;
+		}
+
+		RecordEdit(Layout.IndexOf(Addr));
+		return &Tiles[Layout.IndexOf(Addr)];
+	}
+
+	bool IsValidAddr(const FVulHexAddr& Addr) const
+	{
+		return TileIndex(Addr) != INDEX_NONE;
+	}
+
+	/**
+	 * Reads or writes the data of a single tile for binary snapshots and deltas, @see SaveSnapshot.
+	 *
+	 * Called with a loading archive to read Data, and a saving one to write it.
+	 */
+	typedef TFunction<void (FArchive& Ar, TileData& Data)> FTileSerializer;
+
+	/**
+	 * Serializes tile data via FArchive's operator<<.
+	 */
+	static void DefaultTileSerializer(FArchive& Ar, TileData& Data)
+	{
+		Ar << Data;
+	}
+
+	/**
+	 * Writes the whole grid to Out in a compact binary form: its layout, which tiles are in the grid,
+	 * then each tile's data as written by Serializer.
+	 *
+	 * Does not affect change tracking, so can be used to bring a new observer up to date without
+	 * disturbing a stream of deltas to others, @see SaveDelta.
+	 */
+	void SaveSnapshot(TArray<uint8>& Out, const FTileSerializer& Serializer = &DefaultTileSerializer) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE_STR("VulHexgrid::SaveSnapshot")
+
+		FMemoryWriter Ar(Out);
+		WriteHeader(Ar, ESerialized::Snapshot);
+
+		int32 MinQ = Layout.GetMinQ();
+		int32 MinR = Layout.GetMinR();
+		int32 Width = Layout.GetWidth();
+		int32 Height = Layout.GetHeight();
+		Ar << MinQ << MinR << Width << Height;
+
+		// Which layout indices are tiles, 8 per byte.
+		for (int32 Index = 0; Index < Layout.Num(); Index += 8)
+		{
+			uint8 Byte = 0;
+
+			for (int32 Bit = 0; Bit < 8 && Index + Bit < Layout.Num(); ++Bit)
+			{
+				Byte |= Valid[Index + Bit] ? 1 << Bit : 0;
+			}
+
+			Ar << Byte;
+		}
+
+		for (int32 Index = 0; Index < Tiles.Num(); ++Index)
+		{
+			if (Valid[Index])
+			{
+				Serializer(Ar, const_cast<TileData&>(Tiles[Index].Data));
+			}
+		}
+	}
+
+	/**
+	 * Replaces this grid's tiles with those of a snapshot written by @see SaveSnapshot.
+	 *
+	 * Returns false, leaving this grid unchanged, if In is not a valid snapshot. Clears change tracking,
+	 * path caches, the path hierarchy and the connectivity index.
+	 */
+	bool LoadSnapshot(const TArray<uint8>& In, const FTileSerializer& Serializer = &DefaultTileSerializer)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE_STR("VulHexgrid::LoadSnapshot")
+
+		FMemoryReader Ar(In);
+
+		if (!ReadHeader(Ar, ESerialized::Snapshot))
+		{
+			return false;
+		}
+
+		int32 MinQ, MinR, Width, Height;
+		Ar << MinQ << MinR << Width << Height;
+
+		// Each layout index takes at least a bit, so this also bounds what we allocate.
+		if (Ar.IsError() || Width < 0 || Height < 0 || static_cast<int64>(Width) * Height > (Ar.TotalSize() - Ar.Tell()) * 8)
+		{
+			return false;
+		}
+
+		const FVulHexgridLayout NewLayout(MinQ, MinR, Width, Height);
+		TBitArray<> NewValid(false, NewLayout.Num());
+
+		for (int32 Index = 0; Index < NewLayout.Num(); Index += 8)
+		{
+			uint8 Byte;
+			Ar << Byte;
+
+			for (int32 Bit = 0; Bit < 8 && Index + Bit < NewLayout.Num(); ++Bit)
+			{
+				NewValid[Index + Bit] = (Byte & 1 << Bit) != 0;
+			}
+		}
+
+		TArray<FVulTile> NewTiles;
+		NewTiles.SetNum(NewLayout.Num());
+		int32 NewValidCount = 0;
+
+		for (int32 Index = 0; Index < NewLayout.Num() && !Ar.IsError(); ++Index)
+		{
+			NewTiles[Index].Addr = NewLayout.AddrOf(Index);
+
+			if (NewValid[Index])
+			{
+				Serializer(Ar, NewTiles[Index].Data);
+				++NewValidCount;
+			}
+		}
+
+		if (Ar.IsError() || Ar.Tell() != Ar.TotalSize())
+		{
+			return false;
+		}
+
+		Layout = NewLayout;
+		Tiles = MoveTemp(NewTiles);
+		Valid = MoveTemp(NewValid);
+		ValidCount = NewValidCount;
+
+		ClearPathCache();
+		ClearPathHierarchy();
+		ClearConnectivity();
+		ClearChanges();
+
+		return true;
+	}
+
+	/**
+	 * Writes the tiles added, removed or modified since the last delta to Out, then clears change tracking.
+	 *
+	 * Applying each delta in turn, via @see ApplyDelta, to a grid that matched this one when change
+	 * tracking was last cleared brings it up to date. Deltas only contain changed tiles, so are small
+	 * for saves, undo stacks and network sync where few tiles change at once.
+	 *
+	 * Changes are tracked per tile, so a tile that is modified many times is written once.
+	 */
+	void SaveDelta(TArray<uint8>& Out, const FTileSerializer& Serializer = &DefaultTileSerializer)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE_STR("VulHexgrid::SaveDelta")
+
+		FMemoryWriter Ar(Out);
+		WriteHeader(Ar, ESerialized::Delta);
+
+		uint32 Num = ChangedAddrs.Num();
+		Ar.SerializeIntPacked(Num);
+
+		for (const auto& Addr : ChangedAddrs)
+		{
+			const auto Index = Layout.IndexOf(Addr);
+			int32 Q = Addr.Q;
+			int32 R = Addr.R;
+			uint8 IsTile = Valid[Index] ? 1 : 0;
+			Ar << Q << R << IsTile;
+
+			if (IsTile)
+			{
+				Serializer(Ar, Tiles[Index].Data);
+			}
+		}
+
+		ClearChanges();
+	}
+
+	/**
+	 * Applies a delta written by @see SaveDelta, adding, removing and modifying tiles.
+	 *
+	 * Returns false, leaving this grid unchanged, if In is not a valid delta. Applied tiles are
+	 * tracked as changes like any other edit.
+	 */
+	bool ApplyDelta(const TArray<uint8>& In, const FTileSerializer& Serializer = &DefaultTileSerializer)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE_STR("VulHexgrid::ApplyDelta")
+
+		FMemoryReader Ar(In);
+
+		if (!ReadHeader(Ar, ESerialized::Delta))
+		{
+			return false;
+		}
+
+		uint32 Num;
+		Ar.SerializeIntPacked(Num);
+
+		// Each change takes at least 9 bytes, so this also bounds what we allocate.
+		if (Ar.IsError() || Num > (Ar.TotalSize() - Ar.Tell()) / 9)
+		{
+			return false;
+		}
+
+		TArray<TPair<FVulHexAddr, TOptional<TileData>>> Changes;
+		Changes.Reserve(Num);
+
+		for (uint32 I = 0; I < Num && !Ar.IsError(); ++I)
+		{
+			int32 Q, R;
+			uint8 IsTile;
+			Ar << Q << R << IsTile;
+
+			TOptional<TileData> Data;
+
+			if (IsTile)
+			{
+				Serializer(Ar, Data.Emplace());
+			}
+
+			Changes.Add({FVulHexAddr(Q, R), MoveTemp(Data)});
+		}
+
+		if (Ar.IsError() || Ar.Tell() != Ar.TotalSize())
+		{
+			return false;
+		}
+
+		for (const auto& Change : Changes)
+		{
+			if (Change.Value.IsSet())
+			{
+				AddTile(Change.Key, Change.Value.GetValue());
+			} else
+			{
+				RemoveTile(Change.Key);
+			}
+		}
+
+		return true;
+	}
+
+	/**
+	 * The number of tiles added, removed or modified since change tracking was last cleared.
+	 */
+	int32 NumChanges() const
+	{
+		return ChangedAddrs.Num();
+	}
+
+	/**
+	 * Forgets all changes, so the next delta only contains changes from now on, e.g. after saving a
+	 * snapshot that observers will start from.
+	 */
+	void ClearChanges()
+	{
+		ChangedAddrs.Reset();
+		Changed.Init(false, Layout.Num());
+	}
+
+	/**
+	 * Returns the tiles adjacent to To, recursively searching for those tiles' adjacent tiles if the search if max range > 1.
+	 *
+	 * Return an empty array if the provided tile is not valid in this grid.
+	 *
+	 * Tiles closer to To will be returned first; farther tiles later.
+	 */
+	TArray<FVulTile> AdjacentTiles(const FVulHexAddr& To, const int MaxRange = 1, const bool IncludeStart = false) const
+	{
+		if (!IsValidAddr(To))
+		{
+			return {};
+		}
+
+		const FVulHexSpiral Spiral(To, MaxRange);
+
+		TArray<FVulTile> Out;
+		Out.Reserve(FMath::Min(Spiral.Num(), ValidCount));
+
+		for (const auto Addr : Spiral)
+		{
+			if (Addr == To && !IncludeStart)
+			{
+				continue;
+			}
+
+			if (const auto Index = TileIndex(Addr); Index != INDEX_NONE)
+			{
+				Out.Add(Tiles[Index]);
+			}
+		}
+
+		return Out;
+	}
+
+	/**
+	 * As AdjacentTiles, but returns the tiles as a region laid out like this grid.
+	 */
+	FVulHexRegion AdjacentRegion(const FVulHexAddr& To, const int MaxRange = 1, const bool IncludeStart = false) const
+	{
+		FVulHexRegion Out(Layout);
+
+		if (!IsValidAddr(To))
+		{
+			return Out;
+		}
+
+		for (const auto Addr : FVulHexRange(To, MaxRange))
+		{
+			if (const auto Index = TileIndex(Addr); Index != INDEX_NONE)
+			{
+				Out.AddIndex(Index);
+			}
+		}
+
+		if (!IncludeStart)
+		{
+			Out.Remove(To);
+		}
+
+		return Out;
+	}
+
+	/**
+	 * Every tile in this grid as a region, e.g. to limit a @see FVulHexRegion::Dilate to the grid.
+	 *
+	 * Regions produced by a grid share its layout and are only valid until it changes, @see GetLayout.
+	 */
+	FVulHexRegion TileRegion() const
+	{
+		FVulHexRegion Out(Layout);
+
+		for (int32 Index = 0; Index < Tiles.Num(); ++Index)
+		{
+			if (Valid[Index])
+			{
+				Out.AddIndex(Index);
+			}
+		}
+
+		return Out;
+	}
+
+	/**
+	 * The tiles for which Fn returns true, as a region laid out like this grid.
+	 */
+	FVulHexRegion SelectTiles(const FVulTileValidFn& Fn) const
+	{
+		FVulHexRegion Out(Layout);
+
+		for (int32 Index = 0; Index < Tiles.Num(); ++Index)
+		{
+			if (Valid[Index] && Fn(Tiles[Index]))
+			{
+				Out.AddIndex(Index);
+			}
+		}
+
+		return Out;
+	}
+
+	/**
+	 * The tiles of this grid that are in Region, in layout order. Region must share this grid's layout.
+	 */
+	TArray<FVulTile> GetTiles(const FVulHexRegion& Region) const
+	{
+		checkf(Region.GetLayout() == Layout, TEXT("Hex region is not laid out like this grid"))
+
+		TArray<FVulTile> Out;
+
+		Region.ForEachIndex([&](const int32 Index)
+		{
+			if (Valid[Index])
+			{
+				Out.Add(Tiles[Index]);
+			}
+		});
+
+		return Out;
+	}
+
+	/**
+	 * Returns all tiles scored by ScoreFn then sorted by this score.
+	 *
+	 * ScoreFn may return unset if a tile should be excluded from the results.
+	 *
+	 * Tiles with equal scores are ordered by Q, then R.
+	 */
+	TArray<TPair<FVulTile, float>> ScoreTiles(
+		const TFunction<TOptional<float> (const FVulTile&)>& ScoreFn,
+		const bool Ascending = true
+	) const;
+
+	/**
+	 * As ScoreTiles, but ScoreFn is evaluated for tiles in parallel across worker threads, so must be
+	 * safe to call concurrently.
+	 *
+	 * If Limit is set, only the best Limit tiles are returned, which avoids sorting every scored tile.
+	 * Results are identical to ScoreTiles, truncated to Limit.
+	 */
+	TArray<TPair<FVulTile, float>> ScoreTilesParallel(
+		const TFunction<TOptional<float> (const FVulTile&)>& ScoreFn,
+		const bool Ascending = true,
+		const TOptional<int32> Limit = {}
+	) const;
+
+	/**
+	 * Splits the grid in two lists where each tile only appears in either list (or none).
+	 *
+	 * ValidFn filters tiles out entirely, returning false if a tile should not appear in either list.
+	 * By default, all tiles are included.
+	 * 
+	 * SplitFn is responsible for partitioning each tile, returning true for the first list, and false for the second.
+	 * By default, we split down the Q=0 axis (where Q=0 is in the first list).
+	 */
+	void SplitTiles(
+		TArray<FVulHexAddr>& First,
+		TArray<FVulHexAddr>& Second,
+		const FVulTileValidFn& ValidFn = [](const FVulTile& Tile) { return true; },
+		const TFunction<bool (const FVulTile&)>& SplitFn = [](const FVulTile& Tile) { return Tile.Addr.Q >= 0; }
+	) const {
+		for (int32 Index = 0; Index < Tiles.Num(); ++Index)
+		{
+			if (!Valid[Index] || !ValidFn(Tiles[Index]))
+			{
+				continue;
+			}
+			
+			if (SplitFn(Tiles[Index]))
+			{
+				First.Add(Tiles[Index].Addr);
+			} else
+			{
+				Second.Add(Tiles[Index].Addr);
+			}
+		}
+	}
+
+	/**
+	 * As above, but splits tiles in to two regions laid out like this grid.
+	 */
+	void SplitTiles(
+		FVulHexRegion& First,
+		FVulHexRegion& Second,
+		const FVulTileValidFn& ValidFn = [](const FVulTile& Tile) { return true; },
+		const TFunction<bool (const FVulTile&)>& SplitFn = [](const FVulTile& Tile) { return Tile.Addr.Q >= 0; }
+	) const {
+		First = FVulHexRegion(Layout);
+		Second = FVulHexRegion(Layout);
+
+		for (int32 Index = 0; Index < Tiles.Num(); ++Index)
+		{
+			if (Valid[Index] && ValidFn(Tiles[Index]))
+			{
+				(SplitFn(Tiles[Index]) ? First : Second).AddIndex(Index);
+			}
+		}
+	}
+
+private:
+
+	int Size = 0;
+
+	FVulHexgridLayout Layout;
+
+	/**
+	 * One entry per layout index. Only entries flagged in Valid are tiles in this grid.
+	 */
+	TArray<FVulTile> Tiles;
+	TBitArray<> Valid;
+	int32 ValidCount = 0;
+
+	/**
+	 * Layout indices, and their addresses, of tiles changed since change tracking was last cleared,
+	 * @see SaveDelta.
+	 */
+	TBitArray<> Changed;
+	TArray<FVulHexAddr> ChangedAddrs;
+
+	/**
+	 * What a serialized buffer holds, @see SaveSnapshot and SaveDelta.
+	 */
+	enum class ESerialized : uint8 { Snapshot, Delta };
+
+	static constexpr uint32 SerializedMagic = 0x47584856; // "VHXG"
+	static constexpr uint8 SerializedVersion = 1;
+
+	static void WriteHeader(FArchive& Ar, const ESerialized Kind)
+	{
+		uint32 Magic = SerializedMagic;
+		uint8 Version = SerializedVersion;
+		uint8 KindByte = static_cast<uint8>(Kind);
+		Ar << Magic << Version << KindByte;
+	}
+
+	static bool ReadHeader(FArchive& Ar, const ESerialized Kind)
+	{
+		uint32 Magic;
+		uint8 Version, KindByte;
+		Ar << Magic << Version << KindByte;
+
+		return !Ar.IsError() && Magic == SerializedMagic && Version == SerializedVersion && KindByte == static_cast<uint8>(Kind);
+	}
+
+	struct FPathCacheEntry
+	{
+		FName CacheKey;
+		FReachable Result;
+
+		/**
+		 * How many of the cache's Edits are already reflected in Result.
+		 */
+		int32 EditsSeen = 0;
+
+		uint64 LastUsed = 0;
+	};
+
+	struct FPathCache
+	{
+		int32 Capacity = 0;
+		TArray<FPathCacheEntry> Entries;
+
+		/**
+		 * Layout indices of tiles edited since the least up-to-date entry was last repaired.
+		 */
+		TArray<int32> Edits;
+
+		uint64 UseCounter = 0;
+
+		void EvictLeastRecentlyUsed()
+		{
+			int32 Oldest = 0;
+
+			for (int32 I = 1; I < Entries.Num(); ++I)
+			{
+				if (Entries[I].LastUsed < Entries[Oldest].LastUsed)
+				{
+					Oldest = I;
+				}
+			}
+
+			Entries.RemoveAtSwap(Oldest);
+			TrimEdits();
+		}
+
+		/**
+		 * Drops edits that every entry has already seen.
+		 */
+		void TrimEdits()
+		{
+			auto Seen = Edits.Num();
+
+			for (const auto& Entry : Entries)
+			{
+				Seen = FMath::Min(Seen, Entry.EditsSeen);
+			}
+
+			if (Seen == 0)
+			{
+				return;
+			}
+
+			Edits.RemoveAt(0, Seen);
+
+			for (auto& Entry : Entries)
+			{
+				Entry.EditsSeen -= Seen;
+			}
+		}
+	};
+
+	mutable FPathCache PathCache;
+
+	/**
+	 * A move from a tile in one chunk to an adjacent tile in another.
+	 */
+	struct FChunkPortal
+	{
+		int32 From = INDEX_NONE;
+		int32 To = INDEX_NONE;
+		CostType Cost;
+	};
+
+	struct FPathHierarchyChunk
+	{
+		/**
+		 * One portal for each stretch of border this chunk can be left through.
+		 */
+		TArray<FChunkPortal> Exits;
+
+		/**
+		 * Sorted layout indices of the tiles in this chunk at either end of a portal, whether
+		 * leaving or entering.
+		 */
+		TArray<int32> Nodes;
+
+		/**
+		 * The cheapest cost from each of Nodes to each other without leaving this chunk, Nodes.Num()
+		 * squared, or UnreachedCost if there's no such route.
+		 */
+		TArray<CostType> Costs;
+	};
+
+	struct FPathHierarchy
+	{
+		int32 ChunkSize = 0;
+
+		/**
+		 * The key of the cost function the hierarchy is built with, @see SetPathHierarchy.
+		 */
+		FName CacheKey;
+
+		int32 ChunksWide = 0;
+		TArray<FPathHierarchyChunk> Chunks;
+
+		/**
+		 * Chunks that have had tiles edited since they were last built.
+		 */
+		TBitArray<> Dirty;
+		bool bAnyDirty = false;
+	};
+
+	mutable FPathHierarchy PathHierarchy;
+
+	/**
+	 * Connected components of passable tiles, @see SetConnectivity.
+	 *
+	 * Each passable tile is labelled with a node of a union-find forest, so merging components is cheap.
+	 * Splitting a component relabels its tiles with fresh nodes, orphaning the old ones.
+	 */
+	struct FConnectivity
+	{
+		bool bEnabled = false;
+		FName CacheKey;
+		FVulTileValidFn Passable;
+
+		/**
+		 * Per layout index, the tile's node, or INDEX_NONE if it is not passable. Empty until built.
+		 */
+		TArray<int32> Labels;
+
+		/**
+		 * Per node, its parent node. Nodes that are their own parent are the roots of components.
+		 */
+		TArray<int32> Parents;
+
+		/**
+		 * Layout indices of tiles edited since the index was last updated.
+		 */
+		TArray<int32> Edits;
+
+		int32 Find(int32 Node)
+		{
+			while (Parents[Node] != Node)
+			{
+				Parents[Node] = Parents[Parents[Node]];
+				Node = Parents[Node];
+			}
+
+			return Node;
+		}
+
+		void Union(const int32 A, const int32 B)
+		{
+			const auto RootA = Find(A);
+			const auto RootB = Find(B);
+
+			if (RootA != RootB)
+			{
+				Parents[FMath::Max(RootA, RootB)] = FMath::Min(RootA, RootB);
+			}
+		}
+
+		int32 ComponentOf(const int32 Index)
+		{
+			return Labels[Index] == INDEX_NONE ? INDEX_NONE : Find(Labels[Index]);
+		}
+
+		int32 AddNode()
+		{
+			return Parents.Add(Parents.Num());
+		}
+	};
+
+	mutable FConnectivity Connectivity;
+
+	/**
+	 * Working memory for a Dijkstra search confined to one chunk.
+	 */
+	struct FChunkSearch
+	{
+		int32 Chunk = INDEX_NONE;
+
+		/**
+		 * The layout column and row of the chunk's first tile.
+		 */
+		int32 Col = 0;
+		int32 Row = 0;
+
+		/**
+		 * Per tile position in the chunk, @see ChunkSlot.
+		 */
+		TArray<CostType> Costs;
+
+		/**
+		 * The layout index of the next tile on the way back to the search's source.
+		 */
+		TArray<int32> Parents;
+
+		TArray<int32> FrontierHandles;
+		TVulIndexedPriorityQueue<int32, CostType> Frontier;
+	};
+
+	TArray<TPair<FVulTile, float>> ScoreTilesImpl(
+		const TFunction<TOptional<float> (const FVulTile&)>& ScoreFn,
+		const bool Ascending,
+		const TOptional<int32> Limit,
+		const bool Parallel
+	) const;
+
+	/**
+	 * Notes that the tile at Index has changed, so cached results can be repaired.
+	 */
+	void RecordEdit(const int32 Index)
+	{
+		if (!Changed[Index])
+		{
+			Changed[Index] = true;
+			ChangedAddrs.Add(Tiles[Index].Addr);
+		}
+
+		if (!Connectivity.Labels.IsEmpty())
+		{
+			Connectivity.Edits.Add(Index);
+
+			if (Connectivity.Edits.Num() > Layout.Num())
+			{
+				ClearConnectivity();
+			}
+		}
+
+		if (!PathHierarchy.Chunks.IsEmpty())
+		{
+			// Portals into this tile belong to its neighbours' chunks.
+			PathHierarchy.Dirty[ChunkOf(Index)] = true;
+			PathHierarchy.bAnyDirty = true;
+
+			ForEachAdjacentIndex(Index, [&](const int32 Neighbour)
+			{
+				PathHierarchy.Dirty[ChunkOf(Neighbour)] = true;
+			});
+		}
+
+		if (PathCache.Entries.IsEmpty())
+		{
+			return;
+		}
+
+		PathCache.Edits.Add(Index);
+
+		if (PathCache.Edits.Num() > Layout.Num())
+		{
+			// So many edits that repairing would be no cheaper than starting over.
+			ClearPathCache();
+		}
+	}
+
+	/**
+	 * Path's search once any shortcuts have been ruled out, using only Scratch and not the path cache,
+	 * path hierarchy or connectivity index, so is threadsafe for different scratches.
+	 */
+	FPathResult SearchPath(
+		const int32 FromIndex,
+		const int32 ToIndex,
+		const FVulHexAddr& To,
+		const TVulQueryOptions& Opts,
+		FSearchScratch& Scratch
+	) const {
+		Scratch.Begin(Tiles.Num());
+
+		if (Opts.Passable)
+		{
+			UniformSearch(FromIndex, ToIndex, To, Opts, Scratch);
+		} else
+		{
+			AStar(FromIndex, ToIndex, To, Opts.CostFn, Opts.Heuristic, Scratch);
+		}
+
+		return SearchResult(Scratch, ToIndex);
+	}
+
+	/**
+	 * The A* search behind @see Path and @see PathWith, leaving the result in Scratch, which must have begun.
+	 */
+	template <typename CostFnType, typename HeuristicFnType>
+	void AStar(
+		const int32 FromIndex,
+		const int32 ToIndex,
+		const FVulHexAddr& To,
+		const CostFnType& CostFn,
+		const HeuristicFnType& Heuristic,
+		FSearchScratch& Scratch
+	) const {
+		// All of the tiles that we've visited and the real cost to get that far.
+		Scratch.Visit(FromIndex, FromIndex, 0, Heuristic(Tiles[FromIndex].Addr, To));
+
+		// The tiles on the edge of our search space thus far. With its estimated cost (euclidean distance to goal).
+		// The node in this list with the lowest score is the next one we'll check.
+		// Each tile is queued at most once at a time; finding a cheaper route to a queued tile
+		// updates its priority in place.
+		Scratch.Enqueue(FromIndex, 0);
+
+		while (!Scratch.Frontier.IsEmpty())
+		{
+			const auto CurrentIndex = Scratch.Frontier.GetElement(Scratch.Frontier.Pop());
+
+			if (CurrentIndex == ToIndex)
+			{
+				break;
+			}
+
+			const auto& CurrentTile = Tiles[CurrentIndex];
+
+			ForEachAdjacentIndex(CurrentIndex, [&](const int32 NextIndex)
+			{
+				const auto& NextTile = Tiles[NextIndex];
+				const auto Cost = CostFn(CurrentTile, NextTile, this);
+
+				if (!Cost.IsSet())
+				{
+					return;
+				}
+
+				const CostType NewCost = Scratch.Nodes[CurrentIndex].Cost + Cost.GetValue();
+
+				if (!Scratch.IsVisited(NextIndex) || NewCost < Scratch.Nodes[NextIndex].Cost)
+				{
+					const auto EstimatedCost = Heuristic(NextTile.Addr, To);
+					Scratch.Visit(NextIndex, CurrentIndex, NewCost, EstimatedCost);
+					Scratch.Enqueue(NextIndex, NewCost + EstimatedCost);
+				}
+			});
+		}
+
+	}
+
+	/**
+	 * A* search specialised for uniform costs, @see TVulQueryOptions::Passable, leaving the result in Scratch.
+	 *
+	 * Priorities are integers, so the frontier is a bucket queue. Uniform costs are whole numbers
+	 * whatever CostType is, so they convert to priorities exactly.
+	 */
+	void UniformSearch(
+		const int32 FromIndex,
+		const int32 ToIndex,
+		const FVulHexAddr& To,
+		const TVulQueryOptions& Opts,
+		FSearchScratch& Scratch
+	) const {
+		TRACE_CPUPROFILER_EVENT_SCOPE_STR("VulHexgrid::UniformSearch")
+
+		auto& Frontier = Scratch.UniformFrontier;
+		Frontier.Reset();
+
+		const auto StartEstimate = Tiles[FromIndex].Addr.Distance(To);
+		Scratch.Visit(FromIndex, FromIndex, 0, static_cast<CostType>(StartEstimate));
+		Scratch.Nodes[FromIndex].FrontierHandle = Frontier.Add(FromIndex, StartEstimate);
+
+		// Of equal priority, the most recently queued tile is expanded first. That is the furthest along
+		// its route, so ties between symmetric routes are settled by following one of them to the end.
+		while (!Frontier.IsEmpty())
+		{
+			const auto CurrentIndex = Frontier.GetElement(Frontier.Pop());
+
+			if (CurrentIndex == ToIndex)
+			{
+				return;
+			}
+
+			const CostType NewCost = Scratch.Nodes[CurrentIndex].Cost + 1;
+
+			ForEachAdjacentIndex(CurrentIndex, [&](const int32 NextIndex)
+			{
+				auto& Next = Scratch.Nodes[NextIndex];
+
+				if (Next.Generation == Scratch.Generation)
+				{
+					// Impassable tiles are stamped without a parent.
+					if (Next.Parent == INDEX_NONE || Next.Cost <= NewCost)
+					{
+						return;
+					}
+				} else if (!Opts.Passable(Tiles[NextIndex]))
+				{
+					Next.Generation = Scratch.Generation;
+					Next.Parent = INDEX_NONE;
+					return;
+				}
+
+				const auto Estimate = Tiles[NextIndex].Addr.Distance(To);
+				Scratch.Visit(NextIndex, CurrentIndex, NewCost, static_cast<CostType>(Estimate));
+
+				const auto Priority = static_cast<int32>(NewCost) + Estimate;
+
+				if (Frontier.IsQueued(Next.FrontierHandle))
+				{
+					Frontier.Update(Next.FrontierHandle, Priority);
+				} else
+				{
+					Next.FrontierHandle = Frontier.Add(NextIndex, Priority);
+				}
+			});
+		}
+	}
+
+	/**
+	 * Builds a Path result from a search left in Scratch, walking back from To if it was reached, or
+	 * else from the visited tile that got closest.
+	 */
+	FPathResult SearchResult(const FSearchScratch& Scratch, const int32 ToIndex) const
+	{
+		// Grab a path with the lowest remaining estimated cost according to our heuristic.
+		// For complete paths, this will generally be 0 (depending on the heuristic).
+		// Of equally-close tiles, prefer the cheapest to reach.
+		auto Closest = Scratch.VisitOrder[0];
+
+		for (const auto Index : Scratch.VisitOrder)
+		{
+			const auto& Best = Scratch.Nodes[Closest];
+			const auto& Node = Scratch.Nodes[Index];
+
+			if (Best.RemainingEstimatedCost > Node.RemainingEstimatedCost
+				|| (Best.RemainingEstimatedCost == Node.RemainingEstimatedCost && Best.Cost > Node.Cost))
+			{
+				Closest = Index;
+			}
+		}
+
+		FPathResult Result;
+
+		// Walk the path in reverse back to the start point, building a path result along the way.
+		auto Current = Closest;
+
+		do
+		{
+			Result.Tiles.Add(Tiles[Current]);
+			Current = Scratch.Nodes[Current].Parent;
+		} while (Current != Scratch.Nodes[Current].Parent);
+
+		Result.Complete = Closest == ToIndex;
+		Result.Cost = Scratch.Nodes[Closest].Cost;
 
 		// Put the tiles in the order of walking the path.
 		Algo::Reverse(Result.Tiles);
 
-		return Result;
+		return Result;
+	}
+
+	/**
+	 * True if the connectivity index shows that no path query with Opts can get from the tile at
+	 * FromIndex to the tile at ToIndex, @see SetConnectivity.
+	 */
+	bool IsKnownUnreachable(const int32 FromIndex, const int32 ToIndex, const TVulQueryOptions& Opts) const
+	{
+		if (!Connectivity.bEnabled || Opts.CacheKey.IsNone() || Opts.CacheKey != Connectivity.CacheKey)
+		{
+			return false;
+		}
+
+		UpdateConnectivity();
+
+		const auto Target = Connectivity.ComponentOf(ToIndex);
+
+		if (Target == INDEX_NONE)
+		{
+			// Cannot be moved in to.
+			return true;
+		}
+
+		if (const auto Source = Connectivity.ComponentOf(FromIndex); Source != INDEX_NONE)
+		{
+			return Source != Target;
+		}
+
+		// An impassable origin can still be left, in to any of its neighbours' components.
+		bool Unreachable = true;
+
+		ForEachAdjacentIndex(FromIndex, [&](const int32 Neighbour)
+		{
+			Unreachable &= Connectivity.ComponentOf(Neighbour) != Target;
+		});
+
+		return Unreachable;
+	}
+
+	/**
+	 * Brings the connectivity index up to date with edited tiles, building it if needed.
+	 */
+	void UpdateConnectivity() const
+	{
+		auto& Components = Connectivity;
+
+		// Lots of edits, or lots of orphaned nodes from previous splits, are cheaper to start over from.
+		if (Components.Labels.Num() != Layout.Num() || Components.Edits.Num() > Layout.Num() || Components.Parents.Num() > 2 * Layout.Num())
+		{
+			BuildConnectivity();
+			return;
+		}
+
+		if (Components.Edits.IsEmpty())
+		{
+			return;
+		}
+
+		TRACE_CPUPROFILER_EVENT_SCOPE_STR("VulHexgrid::UpdateConnectivity")
+
+		TArray<int32> Split;
+
+		for (const auto Edited : Components.Edits)
+		{
+			const auto WasPassable = Components.Labels[Edited] != INDEX_NONE;
+			const auto IsPassable = Valid[Edited] && Components.Passable(Tiles[Edited]);
+
+			if (WasPassable && !IsPassable)
+			{
+				Split.Add(Components.Labels[Edited]);
+				Components.Labels[Edited] = INDEX_NONE;
+			} else if (!WasPassable && IsPassable)
+			{
+				const auto Node = Components.AddNode();
+				Components.Labels[Edited] = Node;
+
+				ForEachAdjacentIndex(Edited, [&](const int32 Neighbour)
+				{
+					if (Components.Labels[Neighbour] != INDEX_NONE)
+					{
+						Components.Union(Node, Components.Labels[Neighbour]);
+					}
+				});
+			}
+		}
+
+		Components.Edits.Reset();
+
+		if (Split.IsEmpty())
+		{
+			return;
+		}
+
+		// Components that lost a tile may have been split in two, so relabel their tiles from scratch.
+		TBitArray<> SplitRoots(false, Components.Parents.Num());
+
+		for (const auto Node : Split)
+		{
+			SplitRoots[Components.Find(Node)] = true;
+		}
+
+		TArray<int32> Relabel;
+		TBitArray<> IsRelabelled(false, Layout.Num());
+
+		for (int32 Tile = 0; Tile < Components.Labels.Num(); ++Tile)
+		{
+			if (Components.Labels[Tile] != INDEX_NONE && SplitRoots[Components.Find(Components.Labels[Tile])])
+			{
+				Relabel.Add(Tile);
+				IsRelabelled[Tile] = true;
+			}
+		}
+
+		for (const auto Tile : Relabel)
+		{
+			Components.Labels[Tile] = INDEX_NONE;
+		}
+
+		for (const auto Tile : Relabel)
+		{
+			if (Components.Labels[Tile] == INDEX_NONE)
+			{
+				FloodConnectivity(Tile, [&](const int32 Next)
+				{
+					return Components.Labels[Next] == INDEX_NONE && IsRelabelled[Next];
+				});
+			}
+		}
+	}
+
+	/**
+	 * Labels every passable tile with its component from scratch.
+	 */
+	void BuildConnectivity() const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE_STR("VulHexgrid::BuildConnectivity")
+
+		auto& Components = Connectivity;
+		Components.Labels.Init(INDEX_NONE, Layout.Num());
+		Components.Parents.Reset();
+		Components.Edits.Reset();
+
+		// So Passable is evaluated once per tile.
+		TBitArray<> Checked(false, Layout.Num());
+
+		const auto IsPassable = [&](const int32 Tile)
+		{
+			if (Checked[Tile])
+			{
+				return false;
+			}
+
+			Checked[Tile] = true;
+			return Components.Passable(Tiles[Tile]);
+		};
+
+		for (int32 Tile = 0; Tile < Tiles.Num(); ++Tile)
+		{
+			if (Valid[Tile] && IsPassable(Tile))
+			{
+				FloodConnectivity(Tile, IsPassable);
+			}
+		}
+	}
+
+	/**
+	 * Labels Start, and every tile connected to it via tiles for which Joins returns true, with a new node.
+	 *
+	 * Joins is called for unlabelled neighbours only, and at most once per tile that it accepts.
+	 */
+	template <typename FnType>
+	void FloodConnectivity(const int32 Start, const FnType& Joins) const
+	{
+		auto& Components = Connectivity;
+		const auto Node = Components.AddNode();
+
+		TArray<int32> Stack = {Start};
+		Components.Labels[Start] = Node;
+
+		while (!Stack.IsEmpty())
+		{
+			ForEachAdjacentIndex(Stack.Pop(), [&](const int32 Next)
+			{
+				if (Components.Labels[Next] == INDEX_NONE && Joins(Next))
+				{
+					Components.Labels[Next] = Node;
+					Stack.Add(Next);
+				}
+			});
+		}
+	}
+
+	/**
+	 * True if a Path query should try the path hierarchy, @see SetPathHierarchy.
+	 */
+	bool UsesPathHierarchy(const FVulHexAddr& From, const FVulHexAddr& To, const TVulQueryOptions& Opts) const
+	{
+		// Nearby tiles gain nothing from the hierarchy; a regular search stays within a few chunks anyway.
+		return PathHierarchy.ChunkSize > 0
+			&& Opts.CacheKey == PathHierarchy.CacheKey
+			&& From.Distance(To) > 2 * PathHierarchy.ChunkSize;
+	}
+
+	/**
+	 * The index of the path hierarchy chunk that the tile at layout Index belongs to.
+	 */
+	FORCEINLINE int32 ChunkOf(const int32 Index) const
+	{
+		const auto Width = Layout.GetWidth();
+		const auto ChunkSize = PathHierarchy.ChunkSize;
+		return Index / Width / ChunkSize * PathHierarchy.ChunksWide + Index % Width / ChunkSize;
+	}
+
+	/**
+	 * Where the tile at layout Index is in Search's per-tile arrays. The tile must be in Search's chunk.
+	 */
+	FORCEINLINE int32 ChunkSlot(const FChunkSearch& Search, const int32 Index) const
+	{
+		const auto Width = Layout.GetWidth();
+		return (Index / Width - Search.Row) * PathHierarchy.ChunkSize + Index % Width - Search.Col;
+	}
+
+	/**
+	 * Invokes Fn with the layout index of each valid tile in Chunk.
+	 */
+	template <typename FnType>
+	void ForEachChunkIndex(const int32 Chunk, const FnType& Fn) const
+	{
+		const auto Width = Layout.GetWidth();
+		const auto ChunkSize = PathHierarchy.ChunkSize;
+		const auto FirstCol = Chunk % PathHierarchy.ChunksWide * ChunkSize;
+		const auto FirstRow = Chunk / PathHierarchy.ChunksWide * ChunkSize;
+
+		for (int32 Row = FirstRow; Row < FMath::Min(FirstRow + ChunkSize, Layout.GetHeight()); ++Row)
+		{
+			for (int32 Col = FirstCol; Col < FMath::Min(FirstCol + ChunkSize, Width); ++Col)
+			{
+				if (Valid[Row * Width + Col])
+				{
+					Fn(Row * Width + Col);
+				}
+			}
+		}
+	}
+
+	/**
+	 * Invokes Fn with the index of each chunk bordering Chunk (which may share only a corner).
+	 */
+	template <typename FnType>
+	void ForEachNeighbouringChunk(const int32 Chunk, const FnType& Fn) const
+	{
+		const auto ChunksWide = PathHierarchy.ChunksWide;
+		const auto ChunksHigh = PathHierarchy.Chunks.Num() / ChunksWide;
+		const auto ChunkCol = Chunk % ChunksWide;
+		const auto ChunkRow = Chunk / ChunksWide;
+
+		for (int32 Row = FMath::Max(ChunkRow - 1, 0); Row <= FMath::Min(ChunkRow + 1, ChunksHigh - 1); ++Row)
+		{
+			for (int32 Col = FMath::Max(ChunkCol - 1, 0); Col <= FMath::Min(ChunkCol + 1, ChunksWide - 1); ++Col)
+			{
+				if (Row != ChunkRow || Col != ChunkCol)
+				{
+					Fn(Row * ChunksWide + Col);
+				}
+			}
+		}
+	}
+
+	/**
+	 * Dijkstra search from Source over the tiles of Chunk only, writing costs and parents to Out.
+	 *
+	 * If bReverse, costs are of moving from each tile to Source rather than from Source to each tile.
+	 * Stops once Target is reached, if set.
+	 */
+	void SearchChunk(
+		const int32 Chunk,
+		const int32 Source,
+		const bool bReverse,
+		const int32 Target,
+		const TVulQueryOptions& Opts,
+		FChunkSearch& Out
+	) const {
+		const auto ChunkSize = PathHierarchy.ChunkSize;
+		const auto NumSlots = ChunkSize * ChunkSize;
+
+		Out.Chunk = Chunk;
+		Out.Col = Chunk % PathHierarchy.ChunksWide * ChunkSize;
+		Out.Row = Chunk / PathHierarchy.ChunksWide * ChunkSize;
+		Out.Costs.Init(UnreachedCost, NumSlots);
+		Out.Parents.Init(INDEX_NONE, NumSlots);
+		Out.FrontierHandles.Init(INDEX_NONE, NumSlots);
+		Out.Frontier.Reset();
+
+		const auto SourceSlot = ChunkSlot(Out, Source);
+		Out.Costs[SourceSlot] = 0;
+		Out.Parents[SourceSlot] = Source;
+		Out.FrontierHandles[SourceSlot] = Out.Frontier.Add(Source, 0);
+
+		while (!Out.Frontier.IsEmpty())
+		{
+			const auto CurrentIndex = Out.Frontier.GetElement(Out.Frontier.Pop());
+
+			if (CurrentIndex == Target)
+			{
+				break;
+			}
+
+			const auto CurrentCost = Out.Costs[ChunkSlot(Out, CurrentIndex)];
+
+			ForEachAdjacentIndex(CurrentIndex, [&](const int32 NextIndex)
+			{
+				if (ChunkOf(NextIndex) != Chunk)
+				{
+					return;
+				}
+
+				const auto Cost = bReverse
+					? Opts.CostFn(Tiles[NextIndex], Tiles[CurrentIndex], this)
+					: Opts.CostFn(Tiles[CurrentIndex], Tiles[NextIndex], this);
+
+				if (!Cost.IsSet())
+				{
+					return;
+				}
+
+				const CostType NewCost = CurrentCost + Cost.GetValue();
+				const auto NextSlot = ChunkSlot(Out, NextIndex);
+
+				if (NewCost >= Out.Costs[NextSlot])
+				{
+					return;
+				}
+
+				Out.Costs[NextSlot] = NewCost;
+				Out.Parents[NextSlot] = CurrentIndex;
+
+				if (Out.Frontier.IsQueued(Out.FrontierHandles[NextSlot]))
+				{
+					Out.Frontier.Update(Out.FrontierHandles[NextSlot], NewCost);
+				} else
+				{
+					Out.FrontierHandles[NextSlot] = Out.Frontier.Add(NextIndex, NewCost);
+				}
+			});
+		}
+	}
+
+	/**
+	 * Chooses the portals out of Chunk. Of each stretch of adjacent tiles that can move in to the same
+	 * neighbouring chunk, this is the move from the middle of the stretch, or from both of its ends if
+	 * it's long, as per the original HPA* paper.
+	 */
+	void BuildChunkExits(const int32 Chunk, const TVulQueryOptions& Opts) const
+	{
+		constexpr int32 LongStretch = 6;
+
+		TArray<TPair<int32, FChunkPortal>> Crossings;
+
+		ForEachChunkIndex(Chunk, [&](const int32 Index)
+		{
+			ForEachAdjacentIndex(Index, [&](const int32 Neighbour)
+			{
+				const auto NeighbourChunk = ChunkOf(Neighbour);
+
+				if (NeighbourChunk == Chunk)
+				{
+					return;
+				}
+
+				if (const auto Cost = Opts.CostFn(Tiles[Index], Tiles[Neighbour], this); Cost.IsSet())
+				{
+					Crossings.Add({NeighbourChunk, {Index, Neighbour, Cost.GetValue()}});
+				}
+			});
+		});
+
+		Crossings.Sort([](const TPair<int32, FChunkPortal>& A, const TPair<int32, FChunkPortal>& B)
+		{
+			if (A.Key != B.Key)
+			{
+				return A.Key < B.Key;
+			}
+
+			return A.Value.From != B.Value.From ? A.Value.From < B.Value.From : A.Value.To < B.Value.To;
+		});
+
+		auto& Exits = PathHierarchy.Chunks[Chunk].Exits;
+		Exits.Reset();
+
+		TBitArray<> Grouped(false, Crossings.Num());
+		TArray<int32> Stretch;
+
+		for (int32 First = 0; First < Crossings.Num(); ++First)
+		{
+			if (Grouped[First])
+			{
+				continue;
+			}
+
+			// Flood out to crossings into the same chunk from the same or adjacent tiles.
+			Stretch.Reset();
+			Stretch.Add(First);
+			Grouped[First] = true;
+
+			for (int32 I = 0; I < Stretch.Num(); ++I)
+			{
+				const auto& Addr = Tiles[Crossings[Stretch[I]].Value.From].Addr;
+
+				for (int32 Other = First + 1; Other < Crossings.Num() && Crossings[Other].Key == Crossings[First].Key; ++Other)
+				{
+					if (!Grouped[Other] && Addr.Distance(Tiles[Crossings[Other].Value.From].Addr) <= 1)
+					{
+						Grouped[Other] = true;
+						Stretch.Add(Other);
+					}
+				}
+			}
+
+			Stretch.Sort();
+
+			if (Stretch.Num() < LongStretch)
+			{
+				Exits.Add(Crossings[Stretch[Stretch.Num() / 2]].Value);
+			} else
+			{
+				Exits.Add(Crossings[Stretch[0]].Value);
+				Exits.Add(Crossings[Stretch.Last()].Value);
+			}
+		}
+	}
+
+	/**
+	 * Collects the entrances of Chunk and the cheapest routes between them. Requires the exits of Chunk
+	 * and its neighbouring chunks to be up to date.
+	 */
+	void BuildChunkNodes(const int32 Chunk, const TVulQueryOptions& Opts, FChunkSearch& Search) const
+	{
+		auto& Built = PathHierarchy.Chunks[Chunk];
+		Built.Nodes.Reset();
+
+		for (const auto& Exit : Built.Exits)
+		{
+			Built.Nodes.Add(Exit.From);
+		}
+
+		ForEachNeighbouringChunk(Chunk, [&](const int32 Neighbour)
+		{
+			for (const auto& Exit : PathHierarchy.Chunks[Neighbour].Exits)
+			{
+				if (ChunkOf(Exit.To) == Chunk)
+				{
+					Built.Nodes.Add(Exit.To);
+				}
+			}
+		});
+
+		Built.Nodes.Sort();
+		Built.Nodes.SetNum(Algo::Unique(Built.Nodes));
+
+		const auto NumNodes = Built.Nodes.Num();
+		Built.Costs.SetNum(NumNodes * NumNodes);
+
+		for (int32 From = 0; From < NumNodes; ++From)
+		{
+			SearchChunk(Chunk, Built.Nodes[From], false, INDEX_NONE, Opts, Search);
+
+			for (int32 To = 0; To < NumNodes; ++To)
+			{
+				Built.Costs[From * NumNodes + To] = Search.Costs[ChunkSlot(Search, Built.Nodes[To])];
+			}
+		}
+	}
+
+	/**
+	 * Builds the path hierarchy for Opts if needed, or rebuilds any chunks that have been edited.
+	 */
+	void UpdatePathHierarchy(const TVulQueryOptions& Opts) const
+	{
+		auto& Hierarchy = PathHierarchy;
+
+		if (Hierarchy.Chunks.IsEmpty())
+		{
+			const auto ChunkSize = Hierarchy.ChunkSize;
+			const auto ChunksHigh = (Layout.GetHeight() + ChunkSize - 1) / ChunkSize;
+
+			Hierarchy.ChunksWide = (Layout.GetWidth() + ChunkSize - 1) / ChunkSize;
+			Hierarchy.Chunks.Reset();
+			Hierarchy.Chunks.SetNum(Hierarchy.ChunksWide * ChunksHigh);
+			Hierarchy.Dirty.Init(true, Hierarchy.Chunks.Num());
+			Hierarchy.bAnyDirty = true;
+		}
+
+		if (!Hierarchy.bAnyDirty)
+		{
+			return;
+		}
+
+		TRACE_CPUPROFILER_EVENT_SCOPE_STR("VulHexgrid::UpdatePathHierarchy")
+
+		// A chunk's entrances include where its neighbours' exits lead, so a neighbour's routes
+		// between entrances must be rebuilt too if those change.
+		TBitArray<> Affected(false, Hierarchy.Chunks.Num());
+		TArray<int32> OldTargets, NewTargets;
+
+		const auto CollectTargets = [&](const int32 Chunk, TArray<int32>& Out)
+		{
+			Out.Reset();
+
+			for (const auto& Exit : Hierarchy.Chunks[Chunk].Exits)
+			{
+				Out.Add(Exit.To);
+			}
+
+			Out.Sort();
+		};
+
+		const auto MarkMissing = [&](const TArray<int32>& Targets, const TArray<int32>& From)
+		{
+			for (const auto Target : Targets)
+			{
+				if (Algo::BinarySearch(From, Target) == INDEX_NONE)
+				{
+					Affected[ChunkOf(Target)] = true;
+				}
+			}
+		};
+
+		for (int32 Chunk = 0; Chunk < Hierarchy.Chunks.Num(); ++Chunk)
+		{
+			if (Hierarchy.Dirty[Chunk])
+			{
+				CollectTargets(Chunk, OldTargets);
+				BuildChunkExits(Chunk, Opts);
+				CollectTargets(Chunk, NewTargets);
+
+				Affected[Chunk] = true;
+				MarkMissing(OldTargets, NewTargets);
+				MarkMissing(NewTargets, OldTargets);
+			}
+		}
+
+		FChunkSearch Search;
+
+		for (int32 Chunk = 0; Chunk < Hierarchy.Chunks.Num(); ++Chunk)
+		{
+			if (Affected[Chunk])
+			{
+				BuildChunkNodes(Chunk, Opts, Search);
+			}
+		}
+
+		Hierarchy.Dirty.Init(false, Hierarchy.Chunks.Num());
+		Hierarchy.bAnyDirty = false;
+	}
+
+	/**
+	 * Finds a complete path from FromIndex to ToIndex through the path hierarchy, which must be
+	 * enabled. Returns unset if the hierarchy has no route between them.
+	 *
+	 * The abstract search runs over Scratch, visiting only entrance tiles plus From and To.
+	 */
+	TOptional<FPathResult> HierarchicalPath(
+		const int32 FromIndex,
+		const int32 ToIndex,
+		const TVulQueryOptions& Opts,
+		FSearchScratch& Scratch
+	) const {
+		TRACE_CPUPROFILER_EVENT_SCOPE_STR("VulHexgrid::HierarchicalPath")
+
+		UpdatePathHierarchy(Opts);
+
+		const auto& To = Tiles[ToIndex].Addr;
+		const auto FromChunk = ChunkOf(FromIndex);
+		const auto ToChunk = ChunkOf(ToIndex);
+
+		// Connects From to its chunk's entrances, and its chunk's entrances to To.
+		FChunkSearch Start, Goal;
+		SearchChunk(FromChunk, FromIndex, false, INDEX_NONE, Opts, Start);
+		SearchChunk(ToChunk, ToIndex, true, INDEX_NONE, Opts, Goal);
+
+		Scratch.Begin(Tiles.Num());
+		Scratch.Visit(FromIndex, FromIndex, 0, Opts.Heuristic(Tiles[FromIndex].Addr, To));
+		Scratch.Enqueue(FromIndex, 0);
+
+		while (!Scratch.Frontier.IsEmpty())
+		{
+			const auto CurrentIndex = Scratch.Frontier.GetElement(Scratch.Frontier.Pop());
+
+			if (CurrentIndex == ToIndex)
+			{
+				break;
+			}
+
+			const auto CurrentCost = Scratch.Nodes[CurrentIndex].Cost;
+			const auto CurrentChunk = ChunkOf(CurrentIndex);
+			const auto& Chunk = PathHierarchy.Chunks[CurrentChunk];
+
+			const auto Relax = [&](const int32 NextIndex, const CostType Cost)
+			{
+				const CostType NewCost = CurrentCost + Cost;
+
+				if (!Scratch.IsVisited(NextIndex) || NewCost < Scratch.Nodes[NextIndex].Cost)
+				{
+					const auto EstimatedCost = Opts.Heuristic(Tiles[NextIndex].Addr, To);
+					Scratch.Visit(NextIndex, CurrentIndex, NewCost, EstimatedCost);
+					Scratch.Enqueue(NextIndex, NewCost + EstimatedCost);
+				}
+			};
+
+			if (CurrentIndex == FromIndex)
+			{
+				for (const auto Node : Chunk.Nodes)
+				{
+					if (const auto Cost = Start.Costs[ChunkSlot(Start, Node)]; Node != FromIndex && Cost != UnreachedCost)
+					{
+						Relax(Node, Cost);
+					}
+				}
+			}
+
+			if (const auto Node = Algo::BinarySearch(Chunk.Nodes, CurrentIndex); Node != INDEX_NONE)
+			{
+				const auto NumNodes = Chunk.Nodes.Num();
+
+				for (int32 Other = 0; Other < NumNodes; ++Other)
+				{
+					if (const auto Cost = Chunk.Costs[Node * NumNodes + Other]; Other != Node && Cost != UnreachedCost)
+					{
+						Relax(Chunk.Nodes[Other], Cost);
+					}
+				}
+
+				for (const auto& Exit : Chunk.Exits)
+				{
+					if (Exit.From == CurrentIndex)
+					{
+						Relax(Exit.To, Exit.Cost);
+					}
+				}
+			}
+
+			if (CurrentChunk == ToChunk)
+			{
+				if (const auto Cost = Goal.Costs[ChunkSlot(Goal, CurrentIndex)]; Cost != UnreachedCost)
+				{
+					Relax(ToIndex, Cost);
+				}
+			}
+		}
+
+		if (!Scratch.IsVisited(ToIndex))
+		{
+			return {};
+		}
+
+		// The abstract route, from To back to From.
+		TArray<int32> Route;
+
+		for (auto Current = ToIndex; Current != FromIndex; Current = Scratch.Nodes[Current].Parent)
+		{
+			Route.Add(Current);
+		}
+
+		Route.Add(FromIndex);
+		Algo::Reverse(Route);
+
+		FPathResult Result;
+		Result.Complete = true;
+		Result.Cost = Scratch.Nodes[ToIndex].Cost;
+
+		FChunkSearch Refine;
+		TArray<int32> Leg;
+
+		for (int32 Step = 1; Step < Route.Num(); ++Step)
+		{
+			const auto LegFrom = Route[Step - 1];
+			const auto LegTo = Route[Step];
+			const auto LegChunk = ChunkOf(LegFrom);
+
+			if (LegChunk != ChunkOf(LegTo))
+			{
+				// Through a portal.
+				Result.Tiles.Add(Tiles[LegTo]);
+			} else if (LegTo == ToIndex)
+			{
+				// The reverse search from To already points each tile to its next step.
+				for (auto Current = LegFrom; Current != ToIndex;)
+				{
+					Current = Goal.Parents[ChunkSlot(Goal, Current)];
+					Result.Tiles.Add(Tiles[Current]);
+				}
+			} else
+			{
+				const auto& Search = LegFrom == FromIndex ? Start : Refine;
+
+				if (LegFrom != FromIndex)
+				{
+					SearchChunk(LegChunk, LegFrom, false, LegTo, Opts, Refine);
+				}
+
+				Leg.Reset();
+
+				for (auto Current = LegTo; Current != LegFrom; Current = Search.Parents[ChunkSlot(Search, Current)])
+				{
+					Leg.Add(Current);
+				}
+
+				for (int32 I = Leg.Num() - 1; I >= 0; --I)
+				{
+					Result.Tiles.Add(Tiles[Leg[I]]);
+				}
+			}
+		}
+
+		return Result;
+	}
+
+	/**
+	 * Runs the Dijkstra search behind @see Reachable from scratch, writing to Out.
+	 */
+	template <typename CostFnType>
+	void Flood(
+		const int32 FromIndex,
+		const TOptional<CostType> MaxCost,
+		const CostFnType& CostFn,
+		FReachable& Out
+	) const {
+		Out.Begin(Layout, FromIndex);
+		Out.Relax(FromIndex, FromIndex, 0);
+		ExpandReachable(MaxCost, CostFn, Out, true);
+	}
+
+	/**
+	 * Expands Out's frontier until it's exhausted.
+	 *
+	 * If bRecordReached, tiles are added to Out.Reached as they are settled, which is only correct
+	 * when each tile is settled once.
+	 */
+	template <typename CostFnType>
+	void ExpandReachable(
+		const TOptional<CostType> MaxCost,
+		const CostFnType& CostFn,
+		FReachable& Out,
+		const bool bRecordReached
+	) const {
+		while (!Out.Frontier.IsEmpty())
+		{
+			const auto CurrentIndex = Out.Frontier.GetElement(Out.Frontier.Pop());
+			const auto& CurrentTile = Tiles[CurrentIndex];
+			const auto CurrentCost = Out.Costs[CurrentIndex];
+
+			if (bRecordReached && CurrentIndex != Out.OriginIndex)
+			{
+				Out.Reached.Add(CurrentIndex);
+			}
+
+			ForEachAdjacentIndex(CurrentIndex, [&](const int32 NextIndex)
+			{
+				const auto Cost = CostFn(CurrentTile, Tiles[NextIndex], this);
+
+				if (!Cost.IsSet())
+				{
+					return;
+				}
+
+				const CostType NewCost = CurrentCost + Cost.GetValue();
+
+				if (MaxCost.IsSet() && NewCost > MaxCost.GetValue())
+				{
+					return;
+				}
+
+				Out.Relax(NextIndex, CurrentIndex, NewCost);
+			});
+		}
+	}
+
+	/**
+	 * Walks the straight line from From to To as per @see Trace, asking IsClear whether the tile at each
+	 * layout index along the way is clear. Blocked tiles may be side-stepped according to Leeway.
+	 *
+	 * Returns true if the line reaches To. Tiles along the line are added to OutTiles, if provided.
+	 */
+	template <typename IsClearFnType>
+	bool WalkLine(
+		const FVulHexAddr& From,
+		const FVulHexAddr& To,
+		const float Leeway,
+		const IsClearFnType& IsClear,
+		TArray<FVulHexAddr>* OutTiles
+	) const {
+		const FVulHexLine Line(From, To);
+
+		if (OutTiles)
+		{
+			OutTiles->Add(From);
+		}
+
+		for (auto Step = 1; Step <= Line.Num(); ++Step)
+		{
+			auto Tile = Line.At(Step);
+			const auto Index = TileIndex(Tile);
+
+			if (Index == INDEX_NONE)
+			{
+				return false;
+			}
+
+			if (Leeway > 0.f && !IsClear(Index))
+			{
+				// Blocked, but the line may pass close enough to a neighbouring tile to go through
+				// that instead. This is rare, so the cost of finding alternates is acceptable.
+				bool AlternateFound = false;
+
+				for (const auto& Candidate : Line.Alternates(Step, Leeway))
+				{
+					const auto CandidateIndex = TileIndex(Candidate);
+
+					if (CandidateIndex != INDEX_NONE && IsClear(CandidateIndex))
+					{
+						Tile = Candidate;
+						AlternateFound = true;
+						break;
+					}
+				}
+
+				if (!AlternateFound)
+				{
+					return false;
+				}
+			}
+
+			if (OutTiles)
+			{
+				OutTiles->Add(Tile);
+			}
+		}
+
+		return true;
 	}
 
 	/**
-	 * Returns the size of this grid, that is the number of tiles from the center to an edge.
+	 * Wraps a tile check so it is evaluated at most once per tile, for queries that check the same
+	 * tiles many times.
 	 */
-	int TileCount() const { return Tiles.Num(); };
-
-	TArray<FVulTile> GetTiles() const
+	struct FCachedCheck
 	{
-		TArray<FVulTile> Out;
-		Tiles.GenerateValueArray(Out);
-		return Out;
-	}
+		FCachedCheck(const TVulHexgrid* InGrid, const FVulTileValidFn& InCheck) : Grid(InGrid), Check(InCheck)
+		{
+			Results.SetNumZeroed(Grid->Tiles.Num());
+		}
+
+		bool operator()(const int32 Index) const
+		{
+			if (Results[Index] == 0)
+			{
+				Results[Index] = Check(Grid->Tiles[Index]) ? 1 : 2;
+			}
+
+			return Results[Index] == 1;
+		}
+
+	private:
+		const TVulHexgrid* Grid;
+		const FVulTileValidFn& Check;
+
+		/**
+		 * Per layout index: 0 if not yet checked, 1 if clear, 2 if blocked.
+		 */
+		mutable TArray<uint8> Results;
+	};
 
 	/**
-	 * Gets all the addresses that make up this grid.
+	 * Dijkstra search from multiple seeds at once, each a layout index and the cost to start from it.
+	 *
+	 * Writes the cheapest cost per layout index to OutCosts, and optionally which seed that cost came
+	 * from to OutNearestSeed. Seeds with an INDEX_NONE index are skipped.
 	 */
-	TArray<FVulHexAddr> GetTileAddrs() const
-	{
-		TArray<FVulHexAddr> Out;
-		Tiles.GenerateKeyArray(Out);
-		return Out;
-	}
+	void MultiSourceFlood(
+		const TConstArrayView<TPair<int32, CostType>> Seeds,
+		const TOptional<CostType> MaxCost,
+		const TVulQueryOptions& Opts,
+		TArray<CostType>& OutCosts,
+		TArray<int32>* OutNearestSeed
+	) const {
+		OutCosts.SetNumUninitialized(Layout.Num());
 
-	TOptional<FVulTile> GetTile(const FVulHexAddr& Addr) const
-	{
-		if (!Tiles.Contains(Addr))
+		for (auto& Cost : OutCosts)
 		{
-			return {};
+			Cost = UnreachedCost;
 		}
 
-		return *Tiles.Find(Addr);
-	}
-
-	TOptional<FVulTile> Find(const FVulHexAddr& Addr) const
-	{
-		if (!IsValidAddr(Addr))
+		if (OutNearestSeed)
 		{
-			return {};
+			OutNearestSeed->Init(INDEX_NONE, Layout.Num());
 		}
 
-		return Tiles.FindChecked(Addr);
-	}
+		TVulIndexedPriorityQueue<int32, CostType> Frontier;
+		TArray<int32> Handles;
+		Handles.Init(INDEX_NONE, Layout.Num());
 
-	void SetTileData(const FVulHexAddr& Addr, const TileData& Data)
-	{
-		if (!ensureMsgf(IsValidAddr(Addr), TEXT("Cannot add to grid. Addr=%s is not valid for this grid"), *Addr.ToString()))
+		const auto Relax = [&](const int32 Index, const CostType Cost, const int32 Seed)
 		{
-			return;
-		}
+			if (Cost >= OutCosts[Index] || (MaxCost.IsSet() && Cost > MaxCost.GetValue()))
+			{
+				return;
+			}
 
-		// TODO: Do we destruct properly here?
-		Tiles[Addr] = FVulTile(Addr, Data);
-	}
+			OutCosts[Index] = Cost;
 
-	FVulTile* ModifyTileData(const FVulHexAddr& Addr)
-	{
-		if (!ensureMsgf(IsValidAddr(Addr), TEXT("Cannot modify grid data. Addr=%s is not valid for this grid"), *Addr.ToString()))
+			if (OutNearestSeed)
+			{
+				(*OutNearestSeed)[Index] = Seed;
+			}
+
+			if (Frontier.IsQueued(Handles[Index]))
+			{
+				Frontier.Update(Handles[Index], Cost);
+			} else
+			{
+				Handles[Index] = Frontier.Add(Index, Cost);
+			}
+		};
+
+		for (int32 Seed = 0; Seed < Seeds.Num(); ++Seed)
 		{
-			return nullptr;
+			if (Seeds[Seed].Key != INDEX_NONE)
+			{
+				Relax(Seeds[Seed].Key, Seeds[Seed].Value, Seed);
+			}
 		}
 
-		return Tiles.Find(Addr);
+		while (!Frontier.IsEmpty())
+		{
+			const auto CurrentIndex = Frontier.GetElement(Frontier.Pop());
+			const auto& CurrentTile = Tiles[CurrentIndex];
+			const auto CurrentCost = OutCosts[CurrentIndex];
+			const auto CurrentSeed = OutNearestSeed ? (*OutNearestSeed)[CurrentIndex] : INDEX_NONE;
+
+			ForEachAdjacentIndex(CurrentIndex, [&](const int32 NextIndex)
+			{
+				if (const auto Cost = Opts.CostFn(CurrentTile, Tiles[NextIndex], this); Cost.IsSet())
+				{
+					Relax(NextIndex, CurrentCost + Cost.GetValue(), CurrentSeed);
+				}
+			});
+		}
 	}
 
-	bool IsValidAddr(const FVulHexAddr& Addr) const
-	{
-		return Tiles.Contains(Addr);
+	/**
+	 * InfluenceMap for EInfluenceBlend::Sum. Searches each source only as far as it has influence,
+	 * resetting just the tiles it reached before the next, so the cost is the sum of the sources'
+	 * areas of influence rather than sources x tiles.
+	 */
+	void SumInfluence(
+		const TConstArrayView<FInfluenceSource> Sources,
+		TArray<CostType>& OutInfluence,
+		const TVulQueryOptions& Opts
+	) const {
+		OutInfluence.Init(0, Layout.Num());
+
+		TArray<CostType> Costs;
+		Costs.Init(UnreachedCost, Layout.Num());
+		TArray<int32> Handles;
+		Handles.Init(INDEX_NONE, Layout.Num());
+		TArray<int32> Reached;
+		TVulIndexedPriorityQueue<int32, CostType> Frontier;
+
+		for (const auto& Source : Sources)
+		{
+			const auto SourceIndex = TileIndex(Source.Addr);
+
+			if (Source.Strength <= 0 || SourceIndex == INDEX_NONE)
+			{
+				continue;
+			}
+
+			const auto Relax = [&](const int32 Index, const CostType Cost)
+			{
+				if (Cost >= Source.Strength || Cost >= Costs[Index])
+				{
+					return;
+				}
+
+				if (Costs[Index] == UnreachedCost)
+				{
+					Reached.Add(Index);
+				}
+
+				Costs[Index] = Cost;
+
+				if (Frontier.IsQueued(Handles[Index]))
+				{
+					Frontier.Update(Handles[Index], Cost);
+				} else
+				{
+					Handles[Index] = Frontier.Add(Index, Cost);
+				}
+			};
+
+			Relax(SourceIndex, 0);
+
+			while (!Frontier.IsEmpty())
+			{
+				const auto CurrentIndex = Frontier.GetElement(Frontier.Pop());
+				const auto& CurrentTile = Tiles[CurrentIndex];
+				const auto CurrentCost = Costs[CurrentIndex];
+
+				ForEachAdjacentIndex(CurrentIndex, [&](const int32 NextIndex)
+				{
+					if (const auto Cost = Opts.CostFn(CurrentTile, Tiles[NextIndex], this); Cost.IsSet())
+					{
+						Relax(NextIndex, CurrentCost + Cost.GetValue());
+					}
+				});
+			}
+
+			for (const auto Index : Reached)
+			{
+				OutInfluence[Index] += Source.Strength - Costs[Index];
+				Costs[Index] = UnreachedCost;
+				Handles[Index] = INDEX_NONE;
+			}
+
+			Reached.Reset();
+			Frontier.Reset();
+		}
 	}
 
 	/**
-	 * Returns the tiles adjacent to To, recursively searching for those tiles' adjacent tiles if the search if max range > 1.
-	 *
-	 * Return an empty array if the provided tile is not valid in this grid.
+	 * Updates a complete Reachable result to reflect edits to the tiles at the Edited indices.
 	 *
-	 * Tiles closer to To will be returned first; farther tiles later.
+	 * Every tile whose cheapest route passed through an edited tile is forgotten, then re-reached from
+	 * its unaffected neighbours. Costs that drop because of an edit are propagated outwards. The rest
+	 * of the result is untouched, so small edits cost a fraction of a full search.
 	 */
-	TArray<FVulTile> AdjacentTiles(const FVulHexAddr& To, const int MaxRange = 1, const bool IncludeStart = false) const
+	void RepairReachable(FReachable& Out, const TConstArrayView<int32> Edited, const TVulQueryOptions& Opts) const
 	{
-		if (!IsValidAddr(To))
+		TRACE_CPUPROFILER_EVENT_SCOPE_STR("VulHexgrid::RepairReachable")
+
+		if (Edited.Contains(Out.OriginIndex))
 		{
-			return {};
+			// Every route starts at the origin, so everything is affected.
+			Flood(Out.OriginIndex, {}, Opts.CostFn, Out);
+			return;
 		}
 
-		TArray<FVulTile> Out;
+		// Find each reached tile's affected status by walking its predecessors until reaching a
+		// tile whose status is known, then applying that status to the whole walk.
+		enum class EStatus : uint8 { Unknown, Clean, Affected };
+
+		TArray<EStatus> Status;
+		Status.SetNumZeroed(Out.Predecessors.Num());
+		Status[Out.OriginIndex] = EStatus::Clean;
+
+		for (const auto Index : Edited)
+		{
+			if (Out.Predecessors[Index] != INDEX_NONE)
+			{
+				Status[Index] = EStatus::Affected;
+			}
+		}
 
-		for (const auto& Addr : FVulHexAddr::GenerateGrid(MaxRange))
+		TArray<int32> Walk;
+		TArray<int32> Affected;
+
+		for (const auto Index : Out.Reached)
 		{
-			const auto Translated = To.Translate(Addr.Vector());
+			auto Current = Index;
 
-			if (Translated == To && !IncludeStart)
+			while (Status[Current] == EStatus::Unknown)
 			{
-				continue;
+				Walk.Add(Current);
+				Current = Out.Predecessors[Current];
 			}
 
-			if (IsValidAddr(Translated))
+			for (const auto Walked : Walk)
 			{
-				Out.Add(GetTile(Translated).GetValue());
+				Status[Walked] = Status[Current];
 			}
+
+			Walk.Reset();
 		}
 
-		return Out;
+		for (const auto Index : Out.Reached)
+		{
+			if (Status[Index] == EStatus::Affected)
+			{
+				Affected.Add(Index);
+			}
+		}
+
+		if (Affected.Num() > Out.Reached.Num() / 2)
+		{
+			Flood(Out.OriginIndex, {}, Opts.CostFn, Out);
+			return;
+		}
+
+		for (const auto Index : Affected)
+		{
+			Out.Predecessors[Index] = INDEX_NONE;
+		}
+
+		Out.Frontier.Reset();
+
+		for (auto& Handle : Out.FrontierHandles)
+		{
+			Handle = INDEX_NONE;
+		}
+
+		// Re-reach affected and edited tiles from their unaffected neighbours. Anything that is now
+		// cheaper to reach, affected or not, is queued and propagates from there.
+		const auto Reseed = [&](const int32 Index)
+		{
+			if (!IsValidIndex(Index))
+			{
+				return;
+			}
+
+			ForEachAdjacentIndex(Index, [&](const int32 Neighbour)
+			{
+				if (Out.Predecessors[Neighbour] == INDEX_NONE)
+				{
+					return;
+				}
+
+				if (const auto Cost = Opts.CostFn(Tiles[Neighbour], Tiles[Index], this); Cost.IsSet())
+				{
+					Out.Relax(Index, Neighbour, Out.Costs[Neighbour] + Cost.GetValue());
+				}
+			});
+		};
+
+		for (const auto Index : Affected)
+		{
+			Reseed(Index);
+		}
+
+		for (const auto Index : Edited)
+		{
+			Reseed(Index);
+		}
+
+		ExpandReachable({}, Opts.CostFn, Out, false);
+		Out.RebuildReached();
 	}
 
-	/**
-	 * Returns all tiles scored by ScoreFn then sorted by this score.
-	 *
-	 * ScoreFn may return unset if a tile should be excluded from the results.
-	 */
-	TArray<TPair<FVulTile, float>> ScoreTiles(
-		const TFunction<TOptional<float> (const FVulTile&)>& ScoreFn,
-		const bool Ascending = true
-	) const;
+	void AddTile(const FVulHexAddr& Addr, const FVulTileAllocator& Allocator)
+	{
+		AddTile(Addr, Allocator(Addr));
+	}
 
 	/**
-	 * Splits the grid in two lists where each tile only appears in either list (or none).
+	 * Invokes Fn with the layout index of each valid tile adjacent to the tile at Index.
 	 *
-	 * ValidFn filters tiles out entirely, returning false if a tile should not appear in either list.
-	 * By default, all tiles are included.
-	 * 
-	 * SplitFn is responsible for partitioning each tile, returning true for the first list, and false for the second.
-	 * By default, we split down the Q=0 axis (where Q=0 is in the first list).
+	 * Visits neighbours in the same order as AdjacentTiles, without allocating or copying tiles.
 	 */
-	void SplitTiles(
-		TArray<FVulHexAddr>& First,
-		TArray<FVulHexAddr>& Second,
-		const FVulTileValidFn& ValidFn = [](const FVulTile& Tile) { return true; },
-		const TFunction<bool (const FVulTile&)>& SplitFn = [](const FVulTile& Tile) { return Tile.Addr.Q >= 0; }
-	) const {
-		for (const auto Tile : Tiles)
+	template <typename FnType>
+	FORCEINLINE void ForEachAdjacentIndex(const int32 Index, const FnType& Fn) const
+	{
+		const auto& Addr = Tiles[Index].Addr;
+
+		for (const auto& Offset : VulRuntime::Hexgrid::AdjacentOffsets)
 		{
-			if (!ValidFn(Tile.Value))
+			const auto Next = Layout.IndexOf(Addr.Q + Offset[0], Addr.R + Offset[1]);
+
+			if (Next != INDEX_NONE && Valid[Next])
 			{
-				continue;
+				Fn(Next);
 			}
-			
-			if (SplitFn(Tile.Value))
-			{
-				First.Add(Tile.Key);
-			} else
+		}
+	}
+
+	/**
+	 * Moves all tiles in to storage for NewLayout, which must contain every existing tile.
+	 */
+	void Relayout(const FVulHexgridLayout& NewLayout)
+	{
+		TArray<FVulTile> NewTiles;
+		NewTiles.SetNum(NewLayout.Num());
+		TBitArray<> NewValid(false, NewLayout.Num());
+
+		for (int32 Index = 0; Index < NewLayout.Num(); ++Index)
+		{
+			NewTiles[Index].Addr = NewLayout.AddrOf(Index);
+		}
+
+		for (int32 Index = 0; Index < Tiles.Num(); ++Index)
+		{
+			if (Valid[Index])
 			{
-				Second.Add(Tile.Key);
+				const auto NewIndex = NewLayout.IndexOf(Tiles[Index].Addr);
+				checkf(NewIndex != INDEX_NONE, TEXT("Hexgrid relayout does not contain existing tile"))
+				NewTiles[NewIndex] = MoveTemp(Tiles[Index]);
+				NewValid[NewIndex] = true;
 			}
 		}
-	}
 
-private:
+		Layout = NewLayout;
+		Tiles = MoveTemp(NewTiles);
+		Valid = MoveTemp(NewValid);
 
-	int Size;
-	TMap<FVulHexAddr, FVulTile> Tiles;
+		Changed.Init(false, Layout.Num());
 
-	void AddTile(const FVulHexAddr& Addr, const FVulTileAllocator& Allocator)
-	{
-		Tiles.Add(Addr, FVulTile(Addr, Allocator(Addr)));
+		for (const auto& Addr : ChangedAddrs)
+		{
+			if (const auto Index = Layout.IndexOf(Addr); Index != INDEX_NONE)
+			{
+				Changed[Index] = true;
+			}
+		}
+
+		// Cached results are indexed by the old layout.
+		ClearPathCache();
+		ClearPathHierarchy();
+		ClearConnectivity();
 	}
 };
 
@@ -607,26 +3755,111 @@ TArray<TPair<typename TVulHexgrid<TileData, CostType>::FVulTile, float>> TVulHex
 	const TFunction<TOptional<float>(const FVulTile&)>& ScoreFn,
 	const bool Ascending
 ) const {
-	TArray<TPair<FVulTile, float>> Out;
+	return ScoreTilesImpl(ScoreFn, Ascending, {}, false);
+}
+
+template <typename TileData, typename CostType>
+TArray<TPair<typename TVulHexgrid<TileData, CostType>::FVulTile, float>> TVulHexgrid<TileData, CostType>::ScoreTilesParallel(
+	const TFunction<TOptional<float>(const FVulTile&)>& ScoreFn,
+	const bool Ascending,
+	const TOptional<int32> Limit
+) const {
+	return ScoreTilesImpl(ScoreFn, Ascending, Limit, true);
+}
+
+template <typename TileData, typename CostType>
+TArray<TPair<typename TVulHexgrid<TileData, CostType>::FVulTile, float>> TVulHexgrid<TileData, CostType>::ScoreTilesImpl(
+	const TFunction<TOptional<float>(const FVulTile&)>& ScoreFn,
+	const bool Ascending,
+	const TOptional<int32> Limit,
+	const bool Parallel
+) const {
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR("VulHexgrid::ScoreTiles")
 
-	for (const auto& Tile : GetTiles())
+	// Scores are written per layout index so workers never contend.
+	TArray<TOptional<float>> Scores;
+	Scores.SetNum(Tiles.Num());
+
+	const auto ScoreIndex = [&](const int32 Index)
+	{
+		if (Valid[Index])
+		{
+			Scores[Index] = ScoreFn(Tiles[Index]);
+		}
+	};
+
+	if (Parallel)
+	{
+		ParallelFor(Tiles.Num(), ScoreIndex);
+	} else
+	{
+		for (int32 Index = 0; Index < Tiles.Num(); ++Index)
+		{
+			ScoreIndex(Index);
+		}
+	}
+
+	TArray<int32> Scored;
+
+	for (int32 Index = 0; Index < Scores.Num(); ++Index)
 	{
-		if (const auto Score = ScoreFn(Tile); Score.IsSet())
+		if (Scores[Index].IsSet())
 		{
-			Out.Add(TPair<FVulTile, float>(Tile, Score.GetValue()));
+			Scored.Add(Index);
 		}
 	}
 
-	Algo::Sort(Out, [Ascending](const TPair<FVulTile, float>& A, const TPair<FVulTile, float>& B) -> bool
+	// True if the tile at layout index A comes before B.
+	const auto Before = [&](const int32 A, const int32 B) -> bool
+	{
+		const auto ScoreA = Scores[A].GetValue();
+		const auto ScoreB = Scores[B].GetValue();
+
+		if (ScoreA != ScoreB)
+		{
+			return Ascending ? ScoreA < ScoreB : ScoreA > ScoreB;
+		}
+
+		// Deterministic order for equal-scoring tiles. Scores compare exactly so this stays a strict
+		// weak ordering, and a limited result is the same as sorting everything and truncating.
+		const auto& AddrA = Tiles[A].Addr;
+		const auto& AddrB = Tiles[B].Addr;
+		return AddrA.Q != AddrB.Q ? AddrA.Q < AddrB.Q : AddrA.R < AddrB.R;
+	};
+
+	if (Limit.IsSet() && Limit.GetValue() < Scored.Num())
 	{
-		if (FMath::IsNearlyEqual(A.Value, B.Value))
+		// Keep the best Limit tiles in a heap whose top is the worst of them, so each remaining
+		// tile only needs comparing against that.
+		const auto After = [&Before](const int32 A, const int32 B) { return Before(B, A); };
+
+		TArray<int32> Best;
+		Best.Reserve(Limit.GetValue());
+
+		for (const auto Index : Scored)
 		{
-			// Deterministic order for equal-scoring tiles.
-			return A.Key.Addr.ToString() < B.Key.Addr.ToString();
+			if (Best.Num() < Limit.GetValue())
+			{
+				Best.HeapPush(Index, After);
+			} else if (Best.Num() > 0 && Before(Index, Best.HeapTop()))
+			{
+				Best.HeapPopDiscard(After);
+				Best.HeapPush(Index, After);
+			}
 		}
 
-		return Ascending ^ (A.Value > B.Value);
-	});
+		Scored = MoveTemp(Best);
+	}
+
+	Algo::Sort(Scored, Before);
+
+	TArray<TPair<FVulTile, float>> Out;
+	Out.Reserve(Scored.Num());
+
+	for (const auto Index : Scored)
+	{
+		Out.Add(TPair<FVulTile, float>(Tiles[Index], Scores[Index].GetValue()));
+	}
 
 	return Out;
 }
@@ -0,0 +1,104 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "VulHexAddr.h"
+
+/**
+ * Maps hexgrid addresses to indices of a dense, contiguous array.
+ *
+ * The layout covers a parallelogram in axial (q, r) space, MinQ..MinQ+Width-1 by MinR..MinR+Height-1,
+ * with tiles stored row by row (one row per R value). Converting between an address and its index
+ * is a handful of integer operations, so per-tile data can live in flat arrays rather than maps.
+ *
+ * A hexagonal grid of size N fits in a (2N+1)x(2N+1) layout; the corners of that parallelogram
+ * are not tiles in the grid, so owners of a layout typically track which indices are in use.
+ */
+struct VULRUNTIME_API FVulHexgridLayout
+{
+	FVulHexgridLayout() = default;
+	FVulHexgridLayout(const int InMinQ, const int InMinR, const int InWidth, const int InHeight);
+
+	/**
+	 * The smallest layout that contains a hexagonal grid extending Size tiles from the origin.
+	 */
+	static FVulHexgridLayout Hexagonal(const int Size);
+
+	/**
+	 * Returns the index of Addr in this layout, or INDEX_NONE if it falls outside.
+	 */
+	FORCEINLINE int32 IndexOf(const FVulHexAddr& Addr) const
+	{
+		return IndexOf(Addr.Q, Addr.R);
+	}
+
+	/**
+	 * Returns the index of the address with the given axial coordinates, or INDEX_NONE if it falls outside.
+	 */
+	FORCEINLINE int32 IndexOf(const int Q, const int R) const
+	{
+		// Addresses before the min bound wrap to large unsigned values, so a single
+		// comparison per axis checks both bounds.
+		const uint32 Col = static_cast<uint32>(Q - MinQ);
+		const uint32 Row = static_cast<uint32>(R - MinR);
+
+		return (Col < static_cast<uint32>(Width)) & (Row < static_cast<uint32>(Height))
+			? static_cast<int32>(Row * Width + Col)
+			: INDEX_NONE;
+	}
+
+	/**
+	 * Returns the address at the given index, which must be valid for this layout.
+	 */
+	FORCEINLINE FVulHexAddr AddrOf(const int32 Index) const
+	{
+		checkf(Index >= 0 && Index < Num(), TEXT("Index %d out of bounds for hexgrid layout"), Index)
+		return FVulHexAddr(MinQ + Index % Width, MinR + Index / Width);
+	}
+
+	/**
+	 * True if Addr falls inside this layout.
+	 */
+	FORCEINLINE bool Contains(const FVulHexAddr& Addr) const
+	{
+		return IndexOf(Addr) != INDEX_NONE;
+	}
+
+	/**
+	 * The number of indices this layout covers, i.e. the size of arrays that store data per index.
+	 */
+	FORCEINLINE int32 Num() const
+	{
+		return Width * Height;
+	}
+
+	/**
+	 * Returns a layout that covers this layout plus Addr.
+	 *
+	 * Grows by more than strictly necessary so that adding tiles one-by-one does not
+	 * repeatedly re-layout.
+	 */
+	FVulHexgridLayout Expand(const FVulHexAddr& Addr) const;
+
+	int GetMinQ() const { return MinQ; }
+	int GetMinR() const { return MinR; }
+	int GetWidth() const { return Width; }
+	int GetHeight() const { return Height; }
+
+	bool operator==(const FVulHexgridLayout& Other) const
+	{
+		return MinQ == Other.MinQ && MinR == Other.MinR && Width == Other.Width && Height == Other.Height;
+	}
+
+	bool operator!=(const FVulHexgridLayout& Other) const
+	{
+		return !(*this == Other);
+	}
+
+	FString ToString() const;
+
+private:
+	int MinQ = 0;
+	int MinR = 0;
+	int Width = 0;
+	int Height = 0;
+};
@@ -89,6 +89,17 @@ struct TVulFieldSerializer<TVulCopyOnWritePtr<T>>
 		return Ctx.Serialize(*Value, Out);
 	}
 
+	static bool Serialize(const TVulCopyOnWritePtr<T>& Value, FVulFieldWriter& Out, struct FVulFieldSerializationContext& Ctx)
+	{
+		if (!Value.IsValid())
+		{
+			Out.Null();
+			return true;
+		}
+
+		return Ctx.Serialize(*Value, Out);
+	}
+
 	static bool Deserialize(const TSharedPtr<FJsonValue>& Data, TVulCopyOnWritePtr<T>& Out, struct FVulFieldDeserializationContext& Ctx)
 	{
 		// TODO.
@@ -0,0 +1,51 @@
+﻿#include "Benchmark.h"
+#include "TestCase.h"
+#include "Misc/AutomationTest.h"
+
+VulTest::FBenchmarkResult VulTest::Benchmark(
+	FAutomationTestBase* TestInstance,
+	const FString& Name,
+	const int32 Iterations,
+	const TFunction<void()>& Fn
+) {
+	Fn();
+
+	const auto Start = FPlatformTime::Seconds();
+
+	for (int32 I = 0; I < Iterations; ++I)
+	{
+		Fn();
+	}
+
+	FBenchmarkResult Result;
+	Result.Name = Name;
+	Result.Iterations = Iterations;
+	Result.TotalSeconds = FPlatformTime::Seconds() - Start;
+
+	Log(TestInstance, FString::Printf(
+		TEXT("%s: %.3f us/iteration (%d iterations, %.3f ms total)"),
+		*Name,
+		Result.MicrosecondsPerIteration(),
+		Iterations,
+		Result.TotalSeconds * 1000.0
+	));
+
+	return Result;
+}
+
+void VulTest::LogSpeedup(
+	FAutomationTestBase* TestInstance,
+	const FBenchmarkResult& Baseline,
+	const FBenchmarkResult& Candidate
+) {
+	const auto Speedup = Candidate.TotalSeconds > 0
+		? Baseline.MicrosecondsPerIteration() / Candidate.MicrosecondsPerIteration()
+		: 0;
+
+	Log(TestInstance, FString::Printf(
+		TEXT("%s vs %s: %.2fx"),
+		*Candidate.Name,
+		*Baseline.Name,
+		Speedup
+	));
+}
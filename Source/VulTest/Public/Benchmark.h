@@ -0,0 +1,49 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+
+class FAutomationTestBase;
+
+namespace VulTest
+{
+	/**
+	 * The timing of a piece of code measured with @see Benchmark.
+	 */
+	struct FBenchmarkResult
+	{
+		FString Name;
+		int32 Iterations = 0;
+		double TotalSeconds = 0;
+
+		/**
+		 * Average time of a single iteration, in microseconds.
+		 */
+		double MicrosecondsPerIteration() const
+		{
+			return Iterations > 0 ? TotalSeconds * 1000000.0 / Iterations : 0;
+		}
+	};
+
+	/**
+	 * Times Fn over the given number of iterations, after one untimed warm-up run, and logs the result
+	 * to the test output.
+	 *
+	 * Intended for perf tests (EAutomationTestFlags::PerfFilter) comparing implementations. Fn should
+	 * do enough work per call that the overhead of invoking it is negligible.
+	 */
+	VULTEST_API FBenchmarkResult Benchmark(
+		FAutomationTestBase* TestInstance,
+		const FString& Name,
+		const int32 Iterations,
+		const TFunction<void ()>& Fn
+	);
+
+	/**
+	 * Logs how much faster Candidate ran compared to Baseline.
+	 */
+	VULTEST_API void LogSpeedup(
+		FAutomationTestBase* TestInstance,
+		const FBenchmarkResult& Baseline,
+		const FBenchmarkResult& Candidate
+	);
+}